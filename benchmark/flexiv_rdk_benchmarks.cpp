@@ -0,0 +1,303 @@
+/**
+ * @file flexiv_rdk_benchmarks.cpp
+ * Microbenchmarks of RDK's hot paths. The offline benchmarks cover the header-only utilities and
+ * real-time building blocks and need no robot. If a robot serial number is given, the online
+ * benchmarks additionally cover the calls that exchange data with the connected robot.
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ * @author Flexiv
+ */
+
+#include <flexiv/rdk/robot.hpp>
+#include <flexiv/rdk/model.hpp>
+#include <flexiv/rdk/rt_logger.hpp>
+#include <flexiv/rdk/spsc_queue.hpp>
+#include <flexiv/rdk/states_buffer.hpp>
+#include <flexiv/rdk/task_monitor.hpp>
+#include <flexiv/rdk/trace.hpp>
+#include <flexiv/rdk/utility.hpp>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace flexiv;
+
+namespace {
+/** Number of timed repetitions of each benchmark, the median is reported */
+constexpr size_t kRepetitions = 15;
+
+/** Robot DoF used by the offline benchmarks */
+constexpr size_t kDoF = 7;
+
+/** Prevents the compiler from optimizing away the benchmarked computation */
+#if defined(_MSC_VER)
+volatile const void* g_escape = nullptr;
+#endif
+
+template <typename T>
+void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    g_escape = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r"(&value) : "memory");
+#endif
+}
+
+/** Result of one benchmark, time per call in [ns] */
+struct BenchmarkResult
+{
+    std::string name;
+    size_t iterations;
+    double min;
+    double median;
+    double max;
+};
+
+std::vector<BenchmarkResult> g_results;
+
+/**
+ * @brief Run a benchmark: one untimed warm-up repetition, then kRepetitions timed repetitions of
+ * [iterations] calls each.
+ */
+template <typename F>
+void Run(const std::string& name, size_t iterations, F&& func)
+{
+    for (size_t i = 0; i < iterations; i++) {
+        func();
+    }
+    std::vector<double> per_call(kRepetitions);
+    for (auto& t : per_call) {
+        auto tic = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            func();
+        }
+        auto toc = std::chrono::steady_clock::now();
+        t = std::chrono::duration<double, std::nano>(toc - tic).count() / iterations;
+    }
+    std::sort(per_call.begin(), per_call.end());
+    g_results.push_back(
+        {name, iterations, per_call.front(), per_call[kRepetitions / 2], per_call.back()});
+    std::printf("%-40s %10.1f %10.1f %10.1f\n", name.c_str(), g_results.back().min,
+        g_results.back().median, g_results.back().max);
+}
+
+/** @brief Robot states filled with non-zero data */
+rdk::RobotStates MakeStates()
+{
+    rdk::RobotStates states;
+    for (auto* vec : {&states.q, &states.theta, &states.dq, &states.dtheta, &states.tau,
+             &states.tau_des, &states.tau_dot, &states.tau_ext}) {
+        vec->resize(kDoF);
+        for (size_t i = 0; i < kDoF; i++) {
+            (*vec)[i] = 0.1 * i;
+        }
+    }
+    return states;
+}
+
+/** @brief Benchmarks that need no robot */
+void RunOfflineBenchmarks()
+{
+    // Utility helpers
+    // =============================================================================================
+    const std::array<double, 4> quat = {0.9185587, 0.1767767, 0.3061862, 0.1767767};
+    Run("utility::Quat2EulerZYX", 1000000,
+        [&]() { DoNotOptimize(rdk::utility::Quat2EulerZYX(quat)); });
+
+    const std::vector<double> rad_vec(kDoF, 0.5);
+    Run("utility::Rad2Deg(vector)", 1000000,
+        [&]() { DoNotOptimize(rdk::utility::Rad2Deg(rad_vec)); });
+
+    const std::array<double, kDoF> rad_arr = {};
+    Run("utility::Rad2Deg(array)", 1000000,
+        [&]() { DoNotOptimize(rdk::utility::Rad2Deg(rad_arr)); });
+
+    std::vector<double> deg_vec(kDoF);
+    Run("utility::Rad2Deg(batch)", 1000000, [&]() {
+        rdk::utility::Rad2Deg(rad_vec.data(), deg_vec.data(), kDoF);
+        DoNotOptimize(deg_vec.data());
+    });
+
+    const std::vector<std::array<double, 4>> quats(1000, quat);
+    std::vector<std::array<double, 3>> eulers(quats.size());
+    Run("utility::Quat2EulerZYX(batch of 1000)", 1000, [&]() {
+        rdk::utility::Quat2EulerZYX(quats.data(), eulers.data(), quats.size());
+        DoNotOptimize(eulers.data());
+    });
+
+    Run("utility::Vec2Str", 100000, [&]() { DoNotOptimize(rdk::utility::Vec2Str(rad_vec)); });
+    Run("utility::Arr2Str", 100000, [&]() { DoNotOptimize(rdk::utility::Arr2Str(rad_arr)); });
+
+    char buffer[256];
+    Run("utility::Nums2Buf", 100000, [&]() {
+        DoNotOptimize(rdk::utility::Nums2Buf(rad_vec.data(), kDoF, buffer, sizeof(buffer)));
+    });
+
+    const rdk::FlexivDataTypes variant = std::vector<double>(kDoF, 0.5);
+    Run("utility::FlexivTypes2Str", 100000,
+        [&]() { DoNotOptimize(rdk::utility::FlexivTypes2Str(variant)); });
+
+    // Robot states copy
+    // =============================================================================================
+    const auto states = MakeStates();
+    Run("RobotStates copy", 1000000, [&]() {
+        rdk::RobotStates copy = states;
+        DoNotOptimize(copy);
+    });
+
+    rdk::FixedRobotStates fixed_states;
+    Run("utility::CopyStates", 1000000, [&]() {
+        rdk::utility::CopyStates(states, fixed_states);
+        DoNotOptimize(fixed_states);
+    });
+
+    // Real-time building blocks
+    // =============================================================================================
+    static rdk::StatesBuffer states_buffer;
+    rdk::StatesSnapshot snapshot;
+    Run("StatesBuffer::Write", 1000000,
+        [&]() { DoNotOptimize(states_buffer.Write(fixed_states)); });
+    Run("StatesBuffer::Read", 1000000, [&]() {
+        states_buffer.Read(snapshot);
+        DoNotOptimize(snapshot);
+    });
+
+    static rdk::SPSCQueue<rdk::FixedRobotStates, 1024> queue;
+    Run("SPSCQueue::Push + Pop", 1000000, [&]() {
+        queue.Push(fixed_states);
+        queue.Pop(fixed_states);
+        DoNotOptimize(fixed_states);
+    });
+
+    static rdk::TimingHistogram histogram;
+    uint64_t value = 0;
+    Run("TimingHistogram::Record", 1000000, [&]() { histogram.Record(value++ % 2000); });
+
+    auto& tracer = rdk::Tracer::instance();
+    auto now = std::chrono::steady_clock::now();
+    Run("Tracer::Record (stopped)", 1000000, [&]() { tracer.Record("benchmark", now, now); });
+    // Size the trace buffer to the calls of the warm-up and all timed repetitions, so that every
+    // call records an event instead of hitting the full buffer
+    constexpr size_t kTracerIterations = 10000;
+    tracer.Start(kTracerIterations * (kRepetitions + 1));
+    Run("Tracer::Record (started)", kTracerIterations,
+        [&]() { tracer.Record("benchmark", now, now); });
+    tracer.Stop();
+
+    // Likewise fit all calls into the logger queue, so that the drop path is not measured even if
+    // the background thread does not pop any message meanwhile
+    auto null_logger = std::make_shared<spdlog::logger>(
+        "benchmark", std::make_shared<spdlog::sinks::null_sink_mt>());
+    rdk::RTLogger rt_logger(null_logger);
+    Run("RTLogger::Log", rdk::RTLogger::kQueueSize / (kRepetitions + 1),
+        [&]() { rt_logger.Info("Loop {} value {:.3f}", value++, 0.5); });
+    if (rt_logger.num_dropped() > 0) {
+        std::printf("%-40s %10llu messages dropped\n", "RTLogger::Log",
+            static_cast<unsigned long long>(rt_logger.num_dropped()));
+    }
+}
+
+/** @brief Benchmarks that exchange data with the connected robot */
+void RunOnlineBenchmarks(const std::string& robot_sn)
+{
+    rdk::Robot robot(robot_sn);
+
+    // Robot states
+    // =============================================================================================
+    Run("Robot::states", 100000, [&]() { DoNotOptimize(robot.states()); });
+
+    // Robot model, needs RDK professional license
+    // =============================================================================================
+    std::unique_ptr<rdk::Model> model;
+    try {
+        model = std::make_unique<rdk::Model>(robot);
+    } catch (const std::exception& e) {
+        spdlog::warn("Skipping Model benchmarks: {}", e.what());
+        return;
+    }
+    const auto states = robot.states();
+    Run("Model::Update", 10000, [&]() { model->Update(states.q, states.dtheta); });
+    Run("Model::J", 10000, [&]() { DoNotOptimize(model->J("flange")); });
+    Run("Model::dJ", 10000, [&]() { DoNotOptimize(model->dJ("flange")); });
+    Run("Model::M", 10000, [&]() { DoNotOptimize(model->M()); });
+    Run("Model::C", 10000, [&]() { DoNotOptimize(model->C()); });
+    Run("Model::g", 10000, [&]() { DoNotOptimize(model->g()); });
+    Run("Model::c", 10000, [&]() { DoNotOptimize(model->c()); });
+
+    // Request-reply to the robot server, fewer iterations due to the round trip
+    Run("Model::reachable", 10,
+        [&]() { DoNotOptimize(model->reachable(states.tcp_pose, states.q, false)); });
+}
+
+/** @brief Write all results to a CSV file */
+void WriteCSV(const std::string& file_path)
+{
+    std::ofstream file(file_path);
+    file << "name,iterations,min_ns,median_ns,max_ns\n";
+    for (const auto& r : g_results) {
+        file << r.name << "," << r.iterations << "," << r.min << "," << r.median << "," << r.max
+             << "\n";
+    }
+    if (!file.good()) {
+        throw std::runtime_error("WriteCSV: Failed to write [" + file_path + "]");
+    }
+}
+
+/** @brief Print program usage help */
+void PrintHelp()
+{
+    // clang-format off
+    std::cout << "Required arguments: None" << std::endl;
+    std::cout << "Optional arguments: [robot_sn] [--csv file_path]" << std::endl;
+    std::cout << "    robot_sn: Serial number of the robot to connect for the online benchmarks. Remove any space, e.g. Rizon4s-123456" << std::endl;
+    std::cout << "    --csv: Also write the results to the specified CSV file" << std::endl;
+    std::cout << std::endl;
+    // clang-format on
+}
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse parameters
+    if (rdk::utility::ProgramArgsExistAny(argc, argv, {"-h", "--help"})) {
+        PrintHelp();
+        return 1;
+    }
+    std::string robot_sn;
+    std::string csv_path;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--csv" && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (argv[i][0] != '-') {
+            robot_sn = argv[i];
+        }
+    }
+
+    try {
+        std::printf("%-40s %10s %10s %10s\n", "Benchmark [ns per call]", "min", "median", "max");
+        RunOfflineBenchmarks();
+        if (!robot_sn.empty()) {
+            RunOnlineBenchmarks(robot_sn);
+        }
+        if (!csv_path.empty()) {
+            WriteCSV(csv_path);
+        }
+    } catch (const std::exception& e) {
+        spdlog::error(e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -6,6 +6,7 @@
  */
 
 #include <flexiv/rdk/robot.hpp>
+#include <flexiv/rdk/rt_logger.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 #include <spdlog/async.h>
@@ -91,6 +92,20 @@ int main(int argc, char* argv[])
     }
 
     spdlog::warn("This message should also appear in the log file");
+
+    // Log from real-time tasks without blocking
+    // =========================================================================================
+    // Writing to console or file can block, which is not allowed in real-time tasks. RTLogger
+    // queues the messages without blocking and a background thread drains them to the default
+    // logger configured above. Routing the default logger through it also queues the messages of
+    // RDK client itself
+    {
+        rdk::RTLogger rt_logger;
+        rt_logger.RouteDefaultLogger();
+        rt_logger.Warn("This message is queued from loop {} and written in the background", 1);
+        spdlog::info("This message is also queued through the routed default logger");
+    }
+
     spdlog::info("Program finished");
 
     return 0;
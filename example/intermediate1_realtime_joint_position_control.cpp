@@ -7,6 +7,7 @@
 
 #include <flexiv/rdk/robot.hpp>
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/command_buffer.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -43,8 +44,8 @@ void PrintHelp()
 }
 
 /** @brief Callback function for realtime periodic task */
-void PeriodicTask(
-    rdk::Robot& robot, const std::string& motion_type, const std::vector<double>& init_pos)
+void PeriodicTask(rdk::Robot& robot, rdk::JointPositionCommand& command,
+    const std::string& motion_type, const std::vector<double>& init_pos)
 {
     // Local periodic loop counter
     static unsigned int loop_counter = 0;
@@ -56,10 +57,9 @@ void PeriodicTask(
                 "PeriodicTask: Fault occurred on the connected robot, exiting ...");
         }
 
-        // Initialize target vectors to hold position
-        std::vector<double> target_pos(robot.info().DoF);
-        std::vector<double> target_vel(robot.info().DoF);
-        std::vector<double> target_acc(robot.info().DoF);
+        // Write targets in place into the preallocated command buffer, target velocities and
+        // accelerations are left 0
+        auto& target_pos = command.positions();
 
         // Set target vectors based on motion type
         if (motion_type == "hold") {
@@ -75,7 +75,7 @@ void PeriodicTask(
         }
 
         // Send target joint position to RDK server
-        robot.StreamJointPosition(target_pos, target_vel, target_acc);
+        command.Commit();
 
         loop_counter++;
 
@@ -157,11 +157,14 @@ int main(int argc, char* argv[])
         auto init_pos = robot.states().q;
         spdlog::info("Initial joint positions set to: {}", rdk::utility::Vec2Str(init_pos));
 
+        // Preallocate joint position command buffer to be used in the periodic task
+        rdk::JointPositionCommand command(robot);
+
         // Create real-time scheduler to run periodic tasks
         rdk::Scheduler scheduler;
         // Add periodic task with 1ms interval and highest applicable priority
-        scheduler.AddTask(
-            std::bind(PeriodicTask, std::ref(robot), std::ref(motion_type), std::ref(init_pos)),
+        scheduler.AddTask(std::bind(PeriodicTask, std::ref(robot), std::ref(command),
+                              std::ref(motion_type), std::ref(init_pos)),
             "HP periodic", 1, scheduler.max_priority());
         // Start all added tasks
         scheduler.Start();
@@ -12,6 +12,7 @@
 
 #include <flexiv/rdk/robot.hpp>
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/command_buffer.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -52,8 +53,9 @@ void PrintHelp()
 }
 
 /** @brief Callback function for realtime periodic task */
-void PeriodicTask(
-    rdk::Robot& robot, const std::string& motion_type, const std::vector<double>& init_pos)
+void PeriodicTask(rdk::Robot& robot, rdk::JointTorqueCommand& command,
+    std::vector<double>& target_pos, const std::string& motion_type,
+    const std::vector<double>& init_pos)
 {
     // Local periodic loop counter
     static unsigned int loop_counter = 0;
@@ -65,9 +67,6 @@ void PeriodicTask(
                 "PeriodicTask: Fault occurred on the connected robot, exiting ...");
         }
 
-        // Target joint positions
-        std::vector<double> target_pos(robot.info().DoF);
-
         // Set target position based on motion type
         if (motion_type == "hold") {
             target_pos = init_pos;
@@ -81,15 +80,19 @@ void PeriodicTask(
                 "PeriodicTask: Unknown motion type. Accepted motion types: hold, sine-sweep");
         }
 
-        // Run impedance control on all joints
-        std::vector<double> target_torque(robot.info().DoF);
+        // Read robot states once so that all joints use the same consistent snapshot
+        const auto states = robot.states();
+
+        // Run impedance control on all joints, write targets in place into the preallocated
+        // command buffer
+        auto& target_torque = command.torques();
         for (size_t i = 0; i < target_torque.size(); ++i) {
-            target_torque[i] = kImpedanceKp[i] * (target_pos[i] - robot.states().q[i])
-                               - kImpedanceKd[i] * robot.states().dtheta[i];
+            target_torque[i] = kImpedanceKp[i] * (target_pos[i] - states.q[i])
+                               - kImpedanceKd[i] * states.dtheta[i];
         }
 
         // Send target joint torque to RDK server
-        robot.StreamJointTorque(target_torque, true);
+        command.Commit(true);
 
         loop_counter++;
 
@@ -173,11 +176,16 @@ int main(int argc, char* argv[])
         auto init_pos = robot.states().q;
         spdlog::info("Initial joint positions set to: {}", rdk::utility::Vec2Str(init_pos));
 
+        // Preallocate joint torque command buffer and target joint positions to be used in the
+        // periodic task, so that it does not allocate
+        rdk::JointTorqueCommand command(robot);
+        std::vector<double> target_pos(init_pos.size());
+
         // Create real-time scheduler to run periodic tasks
         rdk::Scheduler scheduler;
         // Add periodic task with 1ms interval and highest applicable priority
-        scheduler.AddTask(
-            std::bind(PeriodicTask, std::ref(robot), std::ref(motion_type), std::ref(init_pos)),
+        scheduler.AddTask(std::bind(PeriodicTask, std::ref(robot), std::ref(command),
+                              std::ref(target_pos), std::ref(motion_type), std::ref(init_pos)),
             "HP periodic", 1, scheduler.max_priority());
         // Start all added tasks
         scheduler.Start();
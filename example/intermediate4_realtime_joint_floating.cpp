@@ -10,6 +10,7 @@
 
 #include <flexiv/rdk/robot.hpp>
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/states_buffer.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -40,7 +41,7 @@ void PrintHelp()
 }
 
 /** @brief Callback function for realtime periodic task */
-void PeriodicTask(rdk::Robot& robot)
+void PeriodicTask(rdk::Robot& robot, rdk::StatesBuffer& states_buffer)
 {
     try {
         // Monitor fault on the connected robot
@@ -52,9 +53,15 @@ void PeriodicTask(rdk::Robot& robot)
         // Set 0 joint torques
         std::vector<double> target_torque(robot.info().DoF);
 
+        // Read robot states once and publish them, so that other threads can read the same
+        // consistent snapshot without locking
+        const auto states = robot.states();
+        states_buffer.Write(states);
+
         // Add some velocity damping
+        const auto& dtheta = states.dtheta;
         for (size_t i = 0; i < target_torque.size(); ++i) {
-            target_torque[i] += -kFloatingDamping[i] * robot.states().dtheta[i];
+            target_torque[i] += -kFloatingDamping[i] * dtheta[i];
         }
 
         // Send target joint torque to RDK server, enable gravity compensation and joint limits soft
@@ -128,17 +135,29 @@ int main(int argc, char* argv[])
         // Switch to real-time joint torque control mode
         robot.SwitchMode(rdk::Mode::RT_JOINT_TORQUE);
 
+        // Buffer of robot states published by the periodic task
+        rdk::StatesBuffer states_buffer;
+
         // Create real-time scheduler to run periodic tasks
         rdk::Scheduler scheduler;
         // Add periodic task with 1ms interval and highest applicable priority
-        scheduler.AddTask(
-            std::bind(PeriodicTask, std::ref(robot)), "HP periodic", 1, scheduler.max_priority());
+        scheduler.AddTask(std::bind(PeriodicTask, std::ref(robot), std::ref(states_buffer)),
+            "HP periodic", 1, scheduler.max_priority());
         // Start all added tasks
         scheduler.Start();
 
-        // Block and wait for signal to stop scheduler tasks
+        // Block and wait for signal to stop scheduler tasks, meanwhile print the joint positions
+        // published by the periodic task about once per second
+        rdk::StatesSnapshot snapshot;
+        size_t loop_counter = 0;
         while (!g_stop_sched) {
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (++loop_counter % 1000 == 0 && states_buffer.Read(snapshot)) {
+                const auto& q = snapshot.states.q;
+                const std::vector<double> q_vec(q.begin(), q.begin() + snapshot.states.DoF);
+                spdlog::info("Joint positions of snapshot #{}: {}", snapshot.seq,
+                    rdk::utility::Vec2Str(q_vec));
+            }
         }
         // Received signal to stop scheduler tasks
         scheduler.Stop();
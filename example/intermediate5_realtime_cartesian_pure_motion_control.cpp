@@ -140,12 +140,13 @@ void PeriodicTask(rdk::Robot& robot, const std::array<double, rdk::kPoseSize>& i
         // or robot body
         if (enable_collision) {
             bool collision_detected = false;
-            Eigen::Vector3d ext_force = {robot.states().ext_wrench_in_world[0],
-                robot.states().ext_wrench_in_world[1], robot.states().ext_wrench_in_world[2]};
+            const auto states = robot.states();
+            Eigen::Vector3d ext_force = {states.ext_wrench_in_world[0],
+                states.ext_wrench_in_world[1], states.ext_wrench_in_world[2]};
             if (ext_force.norm() > kExtForceThreshold) {
                 collision_detected = true;
             }
-            for (const auto& v : robot.states().tau_ext) {
+            for (const auto& v : states.tau_ext) {
                 if (fabs(v) > kExtTorqueThreshold) {
                     collision_detected = true;
                 }
@@ -94,8 +94,9 @@ int main(int argc, char* argv[])
             // Mark timer start point
             auto tic = std::chrono::high_resolution_clock::now();
 
-            // Update robot model in dynamics engine
-            model.Update(robot.states().q, robot.states().dtheta);
+            // Update robot model in dynamics engine using one consistent states snapshot
+            const auto states = robot.states();
+            model.Update(states.q, states.dtheta);
 
             // Compute gravity vector
             auto g = model.g();
@@ -0,0 +1,262 @@
+/**
+ * @file batch_ik.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_BATCH_IK_HPP_
+#define FLEXIV_RDK_BATCH_IK_HPP_
+
+#include "model.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct ReachabilityResult
+ * @brief Result of checking one Cartesian pose with BatchReachability::Check().
+ */
+struct ReachabilityResult
+{
+    /** Whether the pose was checked. False if the batch exited early before reaching this pose */
+    bool checked = {};
+
+    /** Whether the pose is reachable */
+    bool reachable = {};
+
+    /** IK solution of the corresponding joint positions, empty if not reachable. Unit: \f$ [rad]
+     * \f$ */
+    std::vector<double> ik_solution = {};
+};
+
+/**
+ * @class BatchReachability
+ * @brief Check reachability of many Cartesian poses in parallel. Each worker thread owns a
+ * dedicated rdk::Model instance and checks poses using Model::reachable(), so the round trips to
+ * the connected robot of different workers overlap. The worker threads are started once and kept
+ * for the lifetime of this instance, so repeated calls to Check() do not pay for thread startup.
+ */
+class BatchReachability
+{
+public:
+    /**
+     * @brief [Blocking] Instantiate the batch reachability checker and start its worker threads.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+     * @param[in] num_threads Number of worker threads, i.e. number of poses checked concurrently.
+     * @throw std::invalid_argument if [num_threads] is 0.
+     * @throw std::runtime_error if the initialization sequence failed.
+     * @throw std::logic_error if the connected robot does not have an RDK professional license; or
+     * the parsed robot model is not supported.
+     * @note This constructor blocks until one rdk::Model instance per worker thread is
+     * instantiated, each of which syncs model data from the connected robot.
+     */
+    BatchReachability(const Robot& robot, size_t num_threads = 4)
+    : dof_(robot.info().DoF)
+    {
+        if (num_threads == 0) {
+            throw std::invalid_argument("BatchReachability: [num_threads] cannot be 0");
+        }
+        for (size_t i = 0; i < num_threads; i++) {
+            models_.emplace_back(std::make_unique<Model>(robot));
+        }
+        try {
+            for (size_t i = 0; i < num_threads; i++) {
+                workers_.emplace_back([this, i]() { Work(*models_[i]); });
+            }
+        } catch (...) {
+            StopWorkers();
+            throw;
+        }
+    }
+
+    /**
+     * @brief [Blocking] Stop the worker threads.
+     */
+    virtual ~BatchReachability() { StopWorkers(); }
+
+    BatchReachability(const BatchReachability&) = delete;
+    BatchReachability& operator=(const BatchReachability&) = delete;
+
+    /**
+     * @brief [Blocking] Check reachability of a batch of Cartesian poses.
+     * @param[in] poses Cartesian poses to be checked.
+     * @param[in] seeds Joint positions to be used as the seeds for solving IK. Either provide one
+     * seed per pose, or a single seed used for all poses.
+     * @param[in] free_orientation Only constrain position and allow orientation to move freely.
+     * @param[in] max_feasible Stop checking more poses once this number of reachable poses is
+     * found. Set 0 to check all poses.
+     * @return Results in the same order as [poses].
+     * @throw std::invalid_argument if size of [seeds] is neither 1 nor the size of [poses], or any
+     * seed does not match robot DoF.
+     * @throw std::runtime_error if failed to get a reply from the connected robot.
+     * @note This function blocks until all poses are checked or the early exit condition is met.
+     * Calls from multiple threads are run one batch at a time.
+     * @note Poses are dispatched in the given order, but up to num_threads poses are in flight at a
+     * time. When exiting early, slightly more than [max_feasible] reachable poses can thus be
+     * returned.
+     */
+    std::vector<ReachabilityResult> Check(const std::vector<std::array<double, kPoseSize>>& poses,
+        const std::vector<std::vector<double>>& seeds, bool free_orientation,
+        size_t max_feasible = 0) const
+    {
+        if (seeds.size() != 1 && seeds.size() != poses.size()) {
+            throw std::invalid_argument(
+                "BatchReachability::Check: Size of [seeds] must be 1 or equal to size of [poses]");
+        }
+        for (const auto& seed : seeds) {
+            if (seed.size() != dof_) {
+                throw std::invalid_argument("BatchReachability::Check: Size of a seed ["
+                                            + std::to_string(seed.size())
+                                            + "] does not match robot DoF ["
+                                            + std::to_string(dof_) + "]");
+            }
+        }
+
+        std::vector<ReachabilityResult> results(poses.size());
+        Job job(poses, seeds, free_orientation, max_feasible, results);
+
+        // Hand the job to all workers and wait until every one of them is done with it
+        std::lock_guard<std::mutex> check_lock(check_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            num_done_ = 0;
+            job_id_++;
+        }
+        cv_.notify_all();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_cv_.wait(lock, [this]() { return num_done_ == workers_.size(); });
+            job_ = nullptr;
+        }
+
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+        return results;
+    }
+
+    /**
+     * @brief [Non-blocking] Number of worker threads.
+     */
+    size_t num_threads() const { return models_.size(); }
+
+private:
+    /** One batch of poses shared by all workers */
+    struct Job
+    {
+        Job(const std::vector<std::array<double, kPoseSize>>& poses_,
+            const std::vector<std::vector<double>>& seeds_, bool free_orientation_,
+            size_t max_feasible_, std::vector<ReachabilityResult>& results_)
+        : poses(poses_)
+        , seeds(seeds_)
+        , free_orientation(free_orientation_)
+        , max_feasible(max_feasible_)
+        , results(results_)
+        {
+        }
+
+        const std::vector<std::array<double, kPoseSize>>& poses;
+        const std::vector<std::vector<double>>& seeds;
+        const bool free_orientation;
+        const size_t max_feasible;
+        std::vector<ReachabilityResult>& results;
+        std::atomic<size_t> next_index = {0};
+        std::atomic<size_t> num_feasible = {0};
+        std::exception_ptr error = nullptr;
+        std::mutex error_mutex;
+    };
+
+    void Work(const Model& model)
+    {
+        uint64_t last_job_id = 0;
+        while (true) {
+            Job* job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&]() { return stop_ || job_id_ != last_job_id; });
+                if (stop_) {
+                    return;
+                }
+                last_job_id = job_id_;
+                job = job_;
+            }
+            Process(model, *job);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                num_done_++;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    static void Process(const Model& model, Job& job)
+    {
+        while (true) {
+            if (job.max_feasible > 0 && job.num_feasible >= job.max_feasible) {
+                return;
+            }
+            const size_t i = job.next_index++;
+            if (i >= job.poses.size()) {
+                return;
+            }
+            try {
+                const auto& seed = job.seeds.size() == 1 ? job.seeds.front() : job.seeds[i];
+                auto ret = model.reachable(job.poses[i], seed, job.free_orientation);
+                job.results[i].checked = true;
+                job.results[i].reachable = ret.first;
+                if (ret.first) {
+                    job.results[i].ik_solution = std::move(ret.second);
+                    job.num_feasible++;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(job.error_mutex);
+                if (!job.error) {
+                    job.error = std::current_exception();
+                }
+                // Stop all workers on the first error
+                job.next_index = job.poses.size();
+                return;
+            }
+        }
+    }
+
+    void StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_) {
+            t.join();
+        }
+    }
+
+    const size_t dof_;
+    std::vector<std::unique_ptr<Model>> models_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex check_mutex_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    mutable std::condition_variable done_cv_;
+    mutable Job* job_ = nullptr;
+    mutable uint64_t job_id_ = 0;
+    mutable size_t num_done_ = 0;
+    bool stop_ = false;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_BATCH_IK_HPP_ */
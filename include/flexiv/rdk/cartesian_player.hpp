@@ -0,0 +1,415 @@
+/**
+ * @file cartesian_player.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_CARTESIAN_PLAYER_HPP_
+#define FLEXIV_RDK_CARTESIAN_PLAYER_HPP_
+
+#include "player_core.hpp"
+#include "robot.hpp"
+#include "trace.hpp"
+#include <Eigen/Eigen>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct CartesianSetpoint
+ * @brief Time-stamped sparse Cartesian setpoint played by CartesianSetpointPlayer.
+ */
+struct CartesianSetpoint
+{
+    /** Time of this setpoint, e.g. capture time of the camera image it is computed from */
+    std::chrono::steady_clock::time_point time = {};
+
+    /** Target TCP pose in world frame: \f$ [x, y, z, q_w, q_x, q_y, q_z]^T \f$. Unit: \f$ [m]:[]
+     * \f$ */
+    std::array<double, kPoseSize> pose = {};
+
+    /** Target TCP wrench, held until the next setpoint, see Robot::StreamCartesianMotionForce().
+     * Unit: \f$ [N]:[Nm] \f$ */
+    std::array<double, kCartDoF> wrench = {};
+};
+
+/**
+ * @class CartesianSetpointPlayer
+ * @brief Plays sparse time-stamped Cartesian setpoints, e.g. from a 30–120 Hz vision servo, by
+ * interpolating them at 1 kHz in an internal real-time task that streams
+ * Robot::StreamCartesianMotionForce(). Setpoints are played with a fixed delay, so that the
+ * setpoint after the current time has usually arrived already. Position is interpolated with a C1
+ * continuous cubic Hermite spline whose knot velocities are the finite differences of the past
+ * setpoints, and orientation with quaternion SLERP. Consistent target velocity and acceleration
+ * are streamed along with the pose.
+ * @note The commanded pose follows the interpolated target with at most the velocity limits given
+ * to the constructor, so a target that jumps, e.g. the first setpoint or a setpoint arriving after
+ * an underrun, is approached instead of stepped to.
+ * @note While no setpoint after the current play time is available, which is counted as an
+ * underrun, the commanded pose settles on the last played setpoint like a critically damped spring
+ * with time constant kUnderrunTimeConstant, within the velocity limits. The robot thus decelerates
+ * smoothly and overshoots that setpoint by about (velocity × kUnderrunTimeConstant / e) at most,
+ * instead of stopping at once. Before the first setpoint, the current TCP pose is held.
+ */
+class CartesianSetpointPlayer
+{
+public:
+    /** Maximum number of setpoints that can be buffered ahead */
+    static constexpr size_t kBufferSize = 256;
+
+    /** Time constant of the settling on the last played setpoint during underruns. Unit: \f$ [s]
+     * \f$ */
+    static constexpr double kUnderrunTimeConstant = 0.05;
+
+    /**
+     * @brief [Blocking] Instantiate the player and its internal real-time scheduler.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot to stream commands to.
+     * @param[in] delay Time by which setpoints are played after their time stamps [ms]. Should be
+     * larger than the setpoint interval plus its latency, e.g. 50 ms for a 30 Hz vision servo.
+     * @param[in] max_linear_vel Maximum linear velocity of the commanded TCP pose towards the
+     * interpolated target. Should be above the speed of the setpoints, which are otherwise followed
+     * with a lag. Unit: \f$ [m/s] \f$.
+     * @param[in] max_angular_vel Maximum angular velocity of the commanded TCP pose towards the
+     * interpolated target, see [max_linear_vel]. Unit: \f$ [rad/s] \f$.
+     * @param[in] cpu_affinity CPU core for the internal real-time task thread to bind to, see
+     * Scheduler::AddTask().
+     * @throw std::runtime_error if the scheduler initialization sequence failed.
+     * @throw std::invalid_argument if [max_linear_vel] or [max_angular_vel] is not positive, or
+     * [cpu_affinity] is invalid.
+     * @note The internal task runs at the scheduler's maximum priority.
+     * @note The instance of flexiv::rdk::Robot must outlive this instance.
+     */
+    CartesianSetpointPlayer(Robot& robot, unsigned int delay = 50, double max_linear_vel = 0.5,
+        double max_angular_vel = 1.0, int cpu_affinity = -1)
+    : robot_(robot)
+    , delay_(std::chrono::milliseconds(delay))
+    , max_linear_step_(MaxStep(max_linear_vel))
+    , max_angular_step_(MaxStep(max_angular_vel))
+    , core_(robot, "CartesianSetpointPlayer", [this]() { Step(); }, cpu_affinity)
+    {
+    }
+
+    /**
+     * @brief [Blocking] Stop the playback if it is running.
+     */
+    virtual ~CartesianSetpointPlayer() = default;
+
+    CartesianSetpointPlayer(const CartesianSetpointPlayer&) = delete;
+    CartesianSetpointPlayer& operator=(const CartesianSetpointPlayer&) = delete;
+
+    /**
+     * @brief [Blocking] Start the internal real-time task, which holds the current TCP pose until
+     * the first setpoint is played. Setpoints left over from a previous run are discarded.
+     * @throw std::logic_error if already started or robot is not in the correct control mode.
+     * @throw std::runtime_error if failed to start the internal real-time task.
+     * @note Applicable control modes: RT_CARTESIAN_MOTION_FORCE.
+     * @note This function blocks until the internal real-time task is started.
+     */
+    void Start()
+    {
+        core_.Start([this]() {
+            if (robot_.mode() != Mode::RT_CARTESIAN_MOTION_FORCE) {
+                throw std::logic_error(
+                    "CartesianSetpointPlayer::Start: Robot is not in the correct control mode");
+            }
+            const auto pose = robot_.states().tcp_pose;
+            position_ = Eigen::Vector3d(pose[0], pose[1], pose[2]);
+            orientation_ = Eigen::Quaterniond(pose[3], pose[4], pose[5], pose[6]).normalized();
+            hold_position_ = position_;
+            hold_orientation_ = orientation_;
+            linear_vel_.setZero();
+            angular_vel_.setZero();
+            linear_acc_.setZero();
+            wrench_ = {};
+            num_knots_ = 0;
+            has_next_ = false;
+        });
+    }
+
+    /**
+     * @brief [Blocking] Stop the internal real-time task and the playback.
+     * @throw std::logic_error if not started yet.
+     * @throw std::runtime_error if failed to stop the internal real-time task.
+     * @warning The robot stops receiving commands once stopped, switch the robot to another mode
+     * afterwards.
+     */
+    void Stop() { core_.Stop(); }
+
+    /**
+     * @brief [Non-blocking] Submit a setpoint to be played after all previously submitted ones.
+     * Called from one non-real-time thread.
+     * @param[in] setpoint Setpoint with a later [time] than the previous one. The quaternion does
+     * not need to be normalized.
+     * @return True if buffered, false if the buffer is full.
+     * @throw std::invalid_argument if [time] is not later than the previous setpoint.
+     * @note The first setpoint played is approached with the velocity limits, see the constructor.
+     */
+    bool Submit(const CartesianSetpoint& setpoint)
+    {
+        // A new run accepts any setpoint time
+        if (core_.TakeReset()) {
+            has_last_submitted_ = false;
+        }
+        if (has_last_submitted_ && setpoint.time <= last_submitted_time_) {
+            throw std::invalid_argument(
+                "CartesianSetpointPlayer::Submit: Setpoint time is not later than the last one");
+        }
+        if (!core_.Push(setpoint)) {
+            return false;
+        }
+        last_submitted_time_ = setpoint.time;
+        has_last_submitted_ = true;
+        return true;
+    }
+
+    /**
+     * @brief [Non-blocking] Number of setpoints buffered and not played yet.
+     */
+    size_t num_buffered() const { return core_.num_buffered(); }
+
+    /**
+     * @brief [Non-blocking] Number of real-time cycles in which no setpoint after the current play
+     * time was available, so the commanded pose settled on the last played setpoint.
+     */
+    uint64_t num_underruns() const { return core_.num_underruns(); }
+
+    /**
+     * @brief [Non-blocking] Whether the internal real-time task has stopped streaming due to an
+     * error, e.g. robot fault or command rejected. See error_message() for details. Cleared by
+     * Start().
+     */
+    bool fault() const { return core_.fault(); }
+
+    /**
+     * @brief [Non-blocking] Message of the error that stopped streaming, empty if fault() is false.
+     */
+    std::string error_message() const { return core_.error_message(); }
+
+private:
+    static constexpr double kPeriod = PlayerCore<CartesianSetpoint, kBufferSize>::kPeriod;
+
+    /** Validate a velocity limit and convert it to a step per cycle */
+    static double MaxStep(double max_vel)
+    {
+        if (!(max_vel > 0)) {
+            throw std::invalid_argument(
+                "CartesianSetpointPlayer: [max_linear_vel] and [max_angular_vel] must be positive");
+        }
+        return max_vel * kPeriod;
+    }
+
+    void Step()
+    {
+        FLEXIV_RDK_TRACE_SCOPE("CartesianSetpointPlayer::Step");
+        if (Interpolate(std::chrono::steady_clock::now() - delay_)) {
+            Track();
+        } else {
+            Settle();
+            core_.CountUnderrun();
+        }
+
+        const std::array<double, kPoseSize> pose = {position_.x(), position_.y(), position_.z(),
+            orientation_.w(), orientation_.x(), orientation_.y(), orientation_.z()};
+        const std::array<double, kCartDoF> velocity = {linear_vel_.x(), linear_vel_.y(),
+            linear_vel_.z(), angular_vel_.x(), angular_vel_.y(), angular_vel_.z()};
+        const std::array<double, kCartDoF> acceleration
+            = {linear_acc_.x(), linear_acc_.y(), linear_acc_.z(), 0.0, 0.0, 0.0};
+        FLEXIV_RDK_TRACE_SCOPE("Robot::StreamCartesianMotionForce");
+        robot_.StreamCartesianMotionForce(pose, wrench_, velocity, acceleration);
+    }
+
+    /** Move the commanded pose to the target, by at most the velocity limits in one cycle */
+    void Track()
+    {
+        const Eigen::Vector3d dp = target_position_ - position_;
+        const double distance = dp.norm();
+        if (distance <= max_linear_step_) {
+            position_ = target_position_;
+            linear_vel_ = target_linear_vel_;
+            linear_acc_ = target_linear_acc_;
+        } else {
+            position_ += dp * (max_linear_step_ / distance);
+            linear_vel_ = dp * (max_linear_step_ / distance / kPeriod);
+            linear_acc_.setZero();
+        }
+
+        Eigen::Quaterniond dq = target_orientation_ * orientation_.conjugate();
+        if (dq.w() < 0) {
+            dq.coeffs() = -dq.coeffs();
+        }
+        const Eigen::AngleAxisd rot(dq);
+        if (rot.angle() <= max_angular_step_) {
+            orientation_ = target_orientation_;
+            angular_vel_ = target_angular_vel_;
+        } else {
+            orientation_
+                = (Eigen::Quaterniond(Eigen::AngleAxisd(max_angular_step_, rot.axis()))
+                      * orientation_)
+                      .normalized();
+            angular_vel_ = rot.axis() * (max_angular_step_ / kPeriod);
+        }
+    }
+
+    /** Move the commanded pose towards the hold pose like a critically damped spring */
+    void Settle()
+    {
+        constexpr double w = 1.0 / kUnderrunTimeConstant;
+        const double max_linear_vel = max_linear_step_ / kPeriod;
+        const double max_angular_vel = max_angular_step_ / kPeriod;
+
+        Eigen::Vector3d vel
+            = linear_vel_ + (w * w * (hold_position_ - position_) - 2 * w * linear_vel_) * kPeriod;
+        if (vel.norm() > max_linear_vel) {
+            vel *= max_linear_vel / vel.norm();
+        }
+        linear_acc_ = (vel - linear_vel_) / kPeriod;
+        linear_vel_ = vel;
+        position_ += linear_vel_ * kPeriod;
+
+        Eigen::Quaterniond dq = hold_orientation_ * orientation_.conjugate();
+        if (dq.w() < 0) {
+            dq.coeffs() = -dq.coeffs();
+        }
+        const Eigen::AngleAxisd rot(dq);
+        angular_vel_ += (w * w * rot.angle() * rot.axis() - 2 * w * angular_vel_) * kPeriod;
+        if (angular_vel_.norm() > max_angular_vel) {
+            angular_vel_ *= max_angular_vel / angular_vel_.norm();
+        }
+        const double angle = angular_vel_.norm() * kPeriod;
+        if (angle > 0) {
+            orientation_
+                = (Eigen::Quaterniond(Eigen::AngleAxisd(angle, angular_vel_.normalized()))
+                      * orientation_)
+                      .normalized();
+        }
+    }
+
+    /**
+     * Write the interpolated target of the given play time to [target_*_] and [wrench_]
+     * @return False if no setpoint after the play time is available, i.e. an underrun. The last
+     * played setpoint is then written to [hold_*_] instead.
+     */
+    bool Interpolate(std::chrono::steady_clock::time_point time)
+    {
+        // Shift knots until [knots_[1]] is the last setpoint before the play time
+        while (true) {
+            if (!has_next_) {
+                if (!core_.Pop(next_)) {
+                    break;
+                }
+                has_next_ = true;
+            }
+            if (next_.time > time) {
+                break;
+            }
+            knots_[0] = knots_[1];
+            knots_[1] = next_;
+            num_knots_ = num_knots_ < 2 ? num_knots_ + 1 : 2;
+            has_next_ = false;
+        }
+        if (num_knots_ == 0 || !has_next_) {
+            if (num_knots_ > 0) {
+                const auto& k = knots_[1];
+                hold_position_ = Eigen::Vector3d(k.pose[0], k.pose[1], k.pose[2]);
+                hold_orientation_
+                    = Eigen::Quaterniond(k.pose[3], k.pose[4], k.pose[5], k.pose[6]).normalized();
+            }
+            return false;
+        }
+
+        // Segment from the last played setpoint [p1] to the next one [p2], with [p0] before [p1]
+        const auto& k1 = knots_[1];
+        const auto& k2 = next_;
+        const double h = Seconds(k2.time - k1.time);
+        const double s = Seconds(time - k1.time) / h;
+        const Eigen::Vector3d p1(k1.pose[0], k1.pose[1], k1.pose[2]);
+        const Eigen::Vector3d p2(k2.pose[0], k2.pose[1], k2.pose[2]);
+        const Eigen::Vector3d v2 = (p2 - p1) / h;
+        Eigen::Vector3d v1 = Eigen::Vector3d::Zero();
+        if (num_knots_ == 2) {
+            const auto& k0 = knots_[0];
+            v1 = (p1 - Eigen::Vector3d(k0.pose[0], k0.pose[1], k0.pose[2]))
+                 / Seconds(k1.time - k0.time);
+        }
+
+        // Cubic Hermite spline for position
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+        const Eigen::Vector3d m1 = h * v1;
+        const Eigen::Vector3d m2 = h * v2;
+        const Eigen::Vector3d pos = (2 * s3 - 3 * s2 + 1) * p1 + (s3 - 2 * s2 + s) * m1
+                                    + (-2 * s3 + 3 * s2) * p2 + (s3 - s2) * m2;
+        const Eigen::Vector3d vel = ((6 * s2 - 6 * s) * p1 + (3 * s2 - 4 * s + 1) * m1
+                                        + (-6 * s2 + 6 * s) * p2 + (3 * s2 - 2 * s) * m2)
+                                    / h;
+        const Eigen::Vector3d acc
+            = ((12 * s - 6) * p1 + (6 * s - 4) * m1 + (-12 * s + 6) * p2 + (6 * s - 2) * m2)
+              / (h * h);
+
+        // SLERP for orientation, with constant angular velocity along the segment
+        const Eigen::Quaterniond q1
+            = Eigen::Quaterniond(k1.pose[3], k1.pose[4], k1.pose[5], k1.pose[6]).normalized();
+        const Eigen::Quaterniond q2
+            = Eigen::Quaterniond(k2.pose[3], k2.pose[4], k2.pose[5], k2.pose[6]).normalized();
+        const Eigen::Quaterniond q = q1.slerp(s, q2);
+        Eigen::Quaterniond q_rel = q2 * q1.conjugate();
+        if (q_rel.w() < 0) {
+            q_rel.coeffs() = -q_rel.coeffs();
+        }
+        const Eigen::AngleAxisd rot_rel(q_rel);
+        const Eigen::Vector3d omega = rot_rel.axis() * rot_rel.angle() / h;
+
+        target_position_ = pos;
+        target_orientation_ = q;
+        target_linear_vel_ = vel;
+        target_linear_acc_ = acc;
+        target_angular_vel_ = omega;
+        wrench_ = k1.wrench;
+        return true;
+    }
+
+    static double Seconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    Robot& robot_;
+    const std::chrono::steady_clock::duration delay_;
+    const double max_linear_step_;
+    const double max_angular_step_;
+
+    /** Written by the submitting thread only */
+    std::chrono::steady_clock::time_point last_submitted_time_ = {};
+    bool has_last_submitted_ = false;
+
+    /** Accessed by the real-time task only, except when the task is not running */
+    std::array<CartesianSetpoint, 2> knots_ = {};
+    size_t num_knots_ = 0;
+    CartesianSetpoint next_;
+    bool has_next_ = false;
+    Eigen::Vector3d target_position_ = Eigen::Vector3d::Zero();
+    Eigen::Quaterniond target_orientation_ = Eigen::Quaterniond::Identity();
+    Eigen::Vector3d target_linear_vel_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d target_linear_acc_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d target_angular_vel_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d hold_position_ = Eigen::Vector3d::Zero();
+    Eigen::Quaterniond hold_orientation_ = Eigen::Quaterniond::Identity();
+    Eigen::Vector3d position_ = Eigen::Vector3d::Zero();
+    Eigen::Quaterniond orientation_ = Eigen::Quaterniond::Identity();
+    Eigen::Vector3d linear_vel_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d angular_vel_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d linear_acc_ = Eigen::Vector3d::Zero();
+    std::array<double, kCartDoF> wrench_ = {};
+
+    /** Last member, so that the real-time task stops before the others are destroyed */
+    PlayerCore<CartesianSetpoint, kBufferSize> core_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_CARTESIAN_PLAYER_HPP_ */
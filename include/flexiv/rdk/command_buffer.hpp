@@ -0,0 +1,121 @@
+/**
+ * @file command_buffer.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_COMMAND_BUFFER_HPP_
+#define FLEXIV_RDK_COMMAND_BUFFER_HPP_
+
+#include "robot.hpp"
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class JointPositionCommand
+ * @brief Preallocated command buffer for Robot::StreamJointPosition(). The buffer is sized to the
+ * robot DoF once at construction, then the user writes the targets in place and commits them every
+ * cycle, so no command vector is allocated in the real-time loop.
+ */
+class JointPositionCommand
+{
+public:
+    /**
+     * @brief [Non-blocking] Instantiate the command buffer and allocate it for the robot DoF.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot to stream commands to.
+     * @note All targets are initialized to 0.
+     */
+    JointPositionCommand(Robot& robot)
+    : robot_(robot)
+    , positions_(robot.info().DoF, 0.0)
+    , velocities_(robot.info().DoF, 0.0)
+    , accelerations_(robot.info().DoF, 0.0)
+    {
+    }
+
+    /**
+     * @brief [Non-blocking] Target joint positions to write in place. Unit: \f$ [rad] \f$.
+     * @warning Do not resize the returned vector.
+     */
+    std::vector<double>& positions() { return positions_; }
+
+    /**
+     * @brief [Non-blocking] Target joint velocities to write in place. Unit: \f$ [rad/s] \f$.
+     * @warning Do not resize the returned vector.
+     */
+    std::vector<double>& velocities() { return velocities_; }
+
+    /**
+     * @brief [Non-blocking] Target joint accelerations to write in place. Unit: \f$ [rad/s^2] \f$.
+     * @warning Do not resize the returned vector.
+     */
+    std::vector<double>& accelerations() { return accelerations_; }
+
+    /**
+     * @brief [Non-blocking] Stream the buffered targets to the robot.
+     * @throw std::invalid_argument if any buffer was resized and no longer matches robot DoF.
+     * @throw std::logic_error if robot is not in the correct control mode.
+     * @throw std::runtime_error if number of timeliness failures has reached limit.
+     * @note Applicable control modes: RT_JOINT_IMPEDANCE, RT_JOINT_POSITION.
+     * @note Real-time (RT).
+     */
+    void Commit() { robot_.StreamJointPosition(positions_, velocities_, accelerations_); }
+
+private:
+    Robot& robot_;
+    std::vector<double> positions_;
+    std::vector<double> velocities_;
+    std::vector<double> accelerations_;
+};
+
+/**
+ * @class JointTorqueCommand
+ * @brief Preallocated command buffer for Robot::StreamJointTorque(). The buffer is sized to the
+ * robot DoF once at construction, then the user writes the targets in place and commits them every
+ * cycle, so no command vector is allocated in the real-time loop.
+ */
+class JointTorqueCommand
+{
+public:
+    /**
+     * @brief [Non-blocking] Instantiate the command buffer and allocate it for the robot DoF.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot to stream commands to.
+     * @note All targets are initialized to 0.
+     */
+    JointTorqueCommand(Robot& robot)
+    : robot_(robot)
+    , torques_(robot.info().DoF, 0.0)
+    {
+    }
+
+    /**
+     * @brief [Non-blocking] Target joint torques to write in place. Unit: \f$ [Nm] \f$.
+     * @warning Do not resize the returned vector.
+     */
+    std::vector<double>& torques() { return torques_; }
+
+    /**
+     * @brief [Non-blocking] Stream the buffered targets to the robot.
+     * @param[in] enable_gravity_comp Enable/disable robot gravity compensation.
+     * @param[in] enable_soft_limits Enable/disable soft limits, see Robot::StreamJointTorque().
+     * @throw std::invalid_argument if any buffer was resized and no longer matches robot DoF.
+     * @throw std::logic_error if robot is not in the correct control mode.
+     * @throw std::runtime_error if number of timeliness failures has reached limit.
+     * @note Applicable control modes: RT_JOINT_TORQUE.
+     * @note Real-time (RT).
+     */
+    void Commit(bool enable_gravity_comp = true, bool enable_soft_limits = true)
+    {
+        robot_.StreamJointTorque(torques_, enable_gravity_comp, enable_soft_limits);
+    }
+
+private:
+    Robot& robot_;
+    std::vector<double> torques_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_COMMAND_BUFFER_HPP_ */
@@ -31,6 +31,9 @@ constexpr size_t kIOPorts = 18;
 /** Maximum number of external axes */
 constexpr size_t kMaxExtAxes = 6;
 
+/** Maximum joint-space degrees of freedom of the full system (robot manipulator + external axes) */
+constexpr size_t kMaxJointDoF = kSerialJointDoF + kMaxExtAxes;
+
 /**
  * @brief Operational status of the robot. Except for the first two, the other enumerators
  * indicate the cause of the robot being not ready to operate.
@@ -301,6 +304,68 @@ struct RobotStates
     std::array<double, kCartDoF> ext_wrench_in_world_raw = {};
 };
 
+/**
+ * @struct FixedRobotStates
+ * @brief Fixed-capacity counterpart of RobotStates. All joint-space data are stored in
+ * std::array of capacity kMaxJointDoF, so the struct is trivially copyable and copying or passing
+ * it around never allocates on the heap.
+ * @see RobotStates, utility::CopyStates().
+ */
+struct FixedRobotStates
+{
+    /** Joint-space degrees of freedom of the full system: \f$ n \f$. Only the first [DoF] elements
+     * of each joint-space array are valid, the rest are 0. */
+    size_t DoF = {};
+
+    /** Same as RobotStates::q. Unit: \f$ [rad] or [m] \f$. */
+    std::array<double, kMaxJointDoF> q = {};
+
+    /** Same as RobotStates::theta. Unit: \f$ [rad] or [m] \f$. */
+    std::array<double, kMaxJointDoF> theta = {};
+
+    /** Same as RobotStates::dq. Unit: \f$ [rad/s] or [m/s] \f$. */
+    std::array<double, kMaxJointDoF> dq = {};
+
+    /** Same as RobotStates::dtheta. Unit: \f$ [rad/s] or [m/s] \f$. */
+    std::array<double, kMaxJointDoF> dtheta = {};
+
+    /** Same as RobotStates::tau. Unit: \f$ [Nm] \f$. */
+    std::array<double, kMaxJointDoF> tau = {};
+
+    /** Same as RobotStates::tau_des. Unit: \f$ [Nm] \f$. */
+    std::array<double, kMaxJointDoF> tau_des = {};
+
+    /** Same as RobotStates::tau_dot. Unit: \f$ [Nm/s] \f$. */
+    std::array<double, kMaxJointDoF> tau_dot = {};
+
+    /** Same as RobotStates::tau_ext. Unit: \f$ [Nm] \f$. */
+    std::array<double, kMaxJointDoF> tau_ext = {};
+
+    /** Same as RobotStates::tcp_pose. Unit: \f$ [m]:[] \f$. */
+    std::array<double, kPoseSize> tcp_pose = {};
+
+    /** Same as RobotStates::tcp_vel. Unit: \f$ [m/s]:[rad/s] \f$. */
+    std::array<double, kCartDoF> tcp_vel = {};
+
+    /** Same as RobotStates::flange_pose. Unit: \f$ [m]:[] \f$. */
+    std::array<double, kPoseSize> flange_pose = {};
+
+    /** Same as RobotStates::ft_sensor_raw. Unit: \f$ [N]:[Nm] \f$. */
+    std::array<double, kCartDoF> ft_sensor_raw = {};
+
+    /** Same as RobotStates::ext_wrench_in_tcp. Unit: \f$ [N]:[Nm] \f$. */
+    std::array<double, kCartDoF> ext_wrench_in_tcp = {};
+
+    /** Same as RobotStates::ext_wrench_in_world. Unit: \f$ [N]:[Nm] \f$. */
+    std::array<double, kCartDoF> ext_wrench_in_world = {};
+
+    /** Same as RobotStates::ext_wrench_in_tcp_raw. Unit: \f$ [N]:[Nm] \f$. */
+    std::array<double, kCartDoF> ext_wrench_in_tcp_raw = {};
+
+    /** Same as RobotStates::ext_wrench_in_world_raw. Unit: \f$ [N]:[Nm] \f$. */
+    std::array<double, kCartDoF> ext_wrench_in_world_raw = {};
+};
+
 /**
  * @struct PlanInfo
  * @brief Information of the on-going primitive/plan.
@@ -429,6 +494,34 @@ struct Coord
     std::string str() const;
 };
 
+/**
+ * @brief Operator overloading to compare two JPos instances member-wise.
+ * @return True if all members are exactly equal.
+ */
+inline bool operator==(const JPos& lhs, const JPos& rhs)
+{
+    return lhs.q_m == rhs.q_m && lhs.q_e == rhs.q_e;
+}
+inline bool operator!=(const JPos& lhs, const JPos& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Operator overloading to compare two Coord instances member-wise.
+ * @return True if all members are exactly equal.
+ */
+inline bool operator==(const Coord& lhs, const Coord& rhs)
+{
+    return lhs.position == rhs.position && lhs.orientation == rhs.orientation
+           && lhs.ref_frame == rhs.ref_frame && lhs.ref_q_m == rhs.ref_q_m
+           && lhs.ref_q_e == rhs.ref_q_e;
+}
+inline bool operator!=(const Coord& lhs, const Coord& rhs)
+{
+    return !(lhs == rhs);
+}
+
 /** Alias of the variant that holds all possible types of data exchanged with Flexiv robots */
 using FlexivDataTypes = std::variant<int, double, std::string, rdk::JPos, rdk::Coord,
     std::vector<int>, std::vector<double>, std::vector<std::string>, std::vector<rdk::JPos>,
@@ -0,0 +1,288 @@
+/**
+ * @file device_channel.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_DEVICE_CHANNEL_HPP_
+#define FLEXIV_RDK_DEVICE_CHANNEL_HPP_
+
+#include "device.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class DeviceChannel
+ * @brief Cyclic command channel to one device for setpoints at high rates, e.g. an external axis
+ * or a dispenser. The command fields and their types are registered once and resolved to slots.
+ * Setting a slot is a wait-free store that is safe from real-time threads. A background thread
+ * sends the changed fields with Device::Command() at a fixed interval, so the caller never waits
+ * for the request and values set faster than the interval are coalesced to the latest one.
+ * @note Any number of threads can set slots concurrently.
+ * @note A failed send does not stop the channel, and fault() reports it until a send succeeds. If
+ * the request failed to be delivered, its fields are sent again with the next send, and sending
+ * continues with an increasing interval of up to kMaxRetryInterval. If the request was rejected, as
+ * the device does not exist or is not enabled, its fields are discarded until they are set again.
+ */
+class DeviceChannel
+{
+public:
+    /** Maximum interval between two sends while delivering requests keeps failing [ms] */
+    static constexpr unsigned int kMaxRetryInterval = 1000;
+
+    /**
+     * @brief [Non-blocking] Instantiate the channel and start its background sending thread.
+     * @param[in] device Reference to the instance of flexiv::rdk::Device to send commands with.
+     * @param[in] name Name of the device, which must be enabled before values are set.
+     * @param[in] fields A map of {command_name, initial_value}. The type of [initial_value] is the
+     * type of the command field, e.g. {{"setSpeed", 0}, {"openValve", false}}. Initial values are
+     * not sent.
+     * @param[in] send_interval Interval between two sends of changed fields [ms].
+     * @throw std::invalid_argument if [fields] is empty or [send_interval] is 0.
+     * @note The instance of flexiv::rdk::Device must outlive this instance.
+     */
+    DeviceChannel(Device& device, const std::string& name,
+        const std::map<std::string, std::variant<bool, int, double>>& fields,
+        unsigned int send_interval = 2)
+    : device_(device)
+    , name_(name)
+    , send_interval_(send_interval)
+    , num_slots_(fields.size())
+    , slots_(new Slot[fields.size()])
+    {
+        if (fields.empty()) {
+            throw std::invalid_argument("DeviceChannel: [fields] cannot be empty");
+        }
+        if (send_interval == 0) {
+            throw std::invalid_argument("DeviceChannel: [send_interval] cannot be 0");
+        }
+        size_t i = 0;
+        for (const auto& f : fields) {
+            slots_[i].field = f.first;
+            slots_[i].type = f.second.index();
+            slots_[i].bits.store(std::visit([](auto v) { return ToBits(v); }, f.second));
+            indices_.emplace(f.first, i);
+            i++;
+        }
+        sender_ = std::thread([this]() { Run(); });
+    }
+
+    /**
+     * @brief [Blocking] Send the fields still changed, then stop the background sending thread.
+     */
+    virtual ~DeviceChannel()
+    {
+        stop_ = true;
+        sender_.join();
+    }
+
+    DeviceChannel(const DeviceChannel&) = delete;
+    DeviceChannel& operator=(const DeviceChannel&) = delete;
+
+    /**
+     * @brief [Non-blocking] Slot of a registered command field, resolve once and use it for Set().
+     * @param[in] field Name of the command field.
+     * @return Slot of the command field.
+     * @throw std::out_of_range if [field] is not registered.
+     */
+    size_t slot(const std::string& field) const { return indices_.at(field); }
+
+    /**
+     * @brief [Non-blocking] Set the value of a boolean command field, to be sent with the next
+     * batch of changed fields.
+     * @param[in] slot Slot of the command field, see slot().
+     * @param[in] value Value to send.
+     * @throw std::out_of_range if [slot] is invalid.
+     * @throw std::invalid_argument if the command field is not boolean.
+     * @note Real-time (RT).
+     */
+    void Set(size_t slot, bool value) { Store(slot, kBool, ToBits(value)); }
+
+    /**
+     * @brief [Non-blocking] Set the value of an integer command field, see Set(size_t, bool).
+     * @note Real-time (RT).
+     */
+    void Set(size_t slot, int value) { Store(slot, kInt, ToBits(value)); }
+
+    /**
+     * @brief [Non-blocking] Set the value of a floating-point command field, see Set(size_t, bool).
+     * @note Real-time (RT).
+     */
+    void Set(size_t slot, double value) { Store(slot, kDouble, ToBits(value)); }
+
+    /**
+     * @brief [Non-blocking] Number of Device::Command() requests sent so far.
+     */
+    uint64_t num_sent() const { return num_sent_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Whether the latest send failed, see error_message(). Cleared once a
+     * later send succeeds.
+     * @note Real-time (RT).
+     */
+    bool fault() const { return fault_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief [Non-blocking] Message of the error of the latest failed send, empty if fault() is
+     * false.
+     */
+    std::string error_message() const
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        return fault() ? error_message_ : "";
+    }
+
+private:
+    /** Indices of the command types in std::variant<bool, int, double> */
+    static constexpr size_t kBool = 0;
+    static constexpr size_t kInt = 1;
+    static constexpr size_t kDouble = 2;
+
+    /** Result of one Device::Command() request */
+    enum class SendResult
+    {
+        SENT,
+        REJECTED, ///< Device does not exist or is not enabled, retrying would fail again.
+        FAILED,   ///< Request failed to be delivered, retrying may succeed.
+    };
+
+    struct Slot
+    {
+        std::string field;
+        size_t type = kBool;
+        std::atomic<uint64_t> bits = {0};
+        std::atomic<bool> dirty = {false};
+    };
+
+    static uint64_t ToBits(bool value) { return value ? 1 : 0; }
+    static uint64_t ToBits(int value) { return static_cast<uint64_t>(static_cast<int64_t>(value)); }
+    static uint64_t ToBits(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static std::variant<bool, int, double> FromBits(size_t type, uint64_t bits)
+    {
+        if (type == kBool) {
+            return bits != 0;
+        } else if (type == kInt) {
+            return static_cast<int>(static_cast<int64_t>(bits));
+        }
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void Store(size_t slot, size_t type, uint64_t bits)
+    {
+        if (slot >= num_slots_) {
+            throw std::out_of_range("DeviceChannel::Set: Slot is invalid");
+        }
+        auto& s = slots_[slot];
+        if (s.type != type) {
+            throw std::invalid_argument(
+                "DeviceChannel::Set: Value type does not match the command field type");
+        }
+        s.bits.store(bits, std::memory_order_relaxed);
+        s.dirty.store(true, std::memory_order_release);
+    }
+
+    void Run()
+    {
+        std::map<std::string, std::variant<bool, int, double>> commands;
+        std::vector<size_t> collected;
+        collected.reserve(num_slots_);
+        unsigned int interval = send_interval_;
+        while (true) {
+            // Check the stop flag before collecting, so that the last values are always sent
+            const bool stopping = stop_;
+            commands.clear();
+            collected.clear();
+            for (size_t i = 0; i < num_slots_; i++) {
+                auto& s = slots_[i];
+                // A value stored after the flag is cleared sets it again and is sent next time
+                if (s.dirty.exchange(false, std::memory_order_acquire)) {
+                    commands.emplace_hint(commands.end(), s.field,
+                        FromBits(s.type, s.bits.load(std::memory_order_relaxed)));
+                    collected.push_back(i);
+                }
+            }
+            if (!commands.empty()) {
+                if (Send(commands) == SendResult::FAILED) {
+                    // Mark the fields as changed again, and back off until a send succeeds again
+                    for (auto i : collected) {
+                        slots_[i].dirty.store(true, std::memory_order_release);
+                    }
+                    interval = std::min(interval * 2, std::max(kMaxRetryInterval, send_interval_));
+                } else {
+                    interval = send_interval_;
+                }
+            }
+            if (stopping) {
+                return;
+            }
+            // Sleep in steps of the send interval, so that a backoff does not delay stopping
+            for (unsigned int t = 0; t < interval && !stop_; t += send_interval_) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(send_interval_));
+            }
+        }
+    }
+
+    /** @return Result of the request, see fault() if not sent */
+    SendResult Send(const std::map<std::string, std::variant<bool, int, double>>& commands)
+    {
+        try {
+            device_.Command(name_, commands);
+            num_sent_.fetch_add(1, std::memory_order_relaxed);
+            fault_.store(false, std::memory_order_release);
+            return SendResult::SENT;
+        } catch (const std::logic_error& e) {
+            SetError(e.what());
+            return SendResult::REJECTED;
+        } catch (const std::exception& e) {
+            SetError(e.what());
+            return SendResult::FAILED;
+        }
+    }
+
+    void SetError(const char* message)
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        error_message_ = message;
+        fault_.store(true, std::memory_order_release);
+    }
+
+    Device& device_;
+    const std::string name_;
+    const unsigned int send_interval_;
+    const size_t num_slots_;
+    std::unique_ptr<Slot[]> slots_;
+    std::map<std::string, size_t> indices_;
+
+    std::atomic<uint64_t> num_sent_ = {0};
+    std::atomic<bool> fault_ = {false};
+    mutable std::mutex error_mutex_;
+    std::string error_message_;
+    std::atomic<bool> stop_ = {false};
+    std::thread sender_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_DEVICE_CHANNEL_HPP_ */
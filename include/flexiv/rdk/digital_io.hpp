@@ -0,0 +1,349 @@
+/**
+ * @file digital_io.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_DIGITAL_IO_HPP_
+#define FLEXIV_RDK_DIGITAL_IO_HPP_
+
+#include "robot.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace flexiv {
+namespace rdk {
+
+/** Bitmask of all digital IO ports, bit i corresponds to port i */
+constexpr uint32_t kIOPortsMask = (uint32_t(1) << kIOPorts) - 1;
+
+static_assert(kIOPorts <= 32, "Digital IO ports do not fit into a 32-bit mask");
+
+/**
+ * @brief [Non-blocking] Pack the states of all digital IO ports into a bitmask.
+ * @param[in] ports States of all ports, e.g. the return value of Robot::digital_inputs().
+ * @return Bitmask where bit i is set if port i is high.
+ * @note Real-time (RT).
+ */
+inline uint32_t PackIOPorts(const std::array<bool, kIOPorts>& ports)
+{
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kIOPorts; i++) {
+        mask |= uint32_t(ports[i]) << i;
+    }
+    return mask;
+}
+
+/**
+ * @brief [Non-blocking] Unpack a bitmask into the states of all digital IO ports.
+ * @param[in] mask Bitmask where bit i is set if port i is high. Bits beyond kIOPorts are ignored.
+ * @return States of all ports. True: port high; false: port low.
+ * @note Real-time (RT).
+ */
+inline std::array<bool, kIOPorts> UnpackIOPorts(uint32_t mask)
+{
+    std::array<bool, kIOPorts> ports;
+    for (size_t i = 0; i < kIOPorts; i++) {
+        ports[i] = (mask >> i) & 1;
+    }
+    return ports;
+}
+
+/**
+ * @brief [Non-blocking] Current reading from all digital input ports as a bitmask, see
+ * Robot::digital_inputs().
+ * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+ * @return Bitmask where bit i is set if input port i is high.
+ */
+inline uint32_t DigitalInputsMask(const Robot& robot)
+{
+    return PackIOPorts(robot.digital_inputs());
+}
+
+/**
+ * @brief [Blocking] Set the digital output ports selected by a bitmask in one request, see
+ * Robot::SetDigitalOutputs().
+ * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+ * @param[in] values Bitmask of the values to set, bit i is the value of output port i.
+ * @param[in] mask Bitmask of the output ports to set, the other ports are left unchanged. Nothing
+ * is sent if 0.
+ * @throw std::invalid_argument if [mask] selects a port beyond kIOPorts.
+ * @throw std::runtime_error if failed to deliver the request to the connected robot.
+ * @note This function blocks until the request is successfully delivered.
+ */
+inline void SetDigitalOutputs(Robot& robot, uint32_t values, uint32_t mask = kIOPortsMask)
+{
+    if (mask & ~kIOPortsMask) {
+        throw std::invalid_argument(
+            "SetDigitalOutputs: [mask] selects ports beyond the " + std::to_string(kIOPorts)
+            + " available ones");
+    }
+    if (mask == 0) {
+        return;
+    }
+    std::map<unsigned int, bool> outputs;
+    for (unsigned int i = 0; i < kIOPorts; i++) {
+        if ((mask >> i) & 1) {
+            outputs.emplace_hint(outputs.end(), i, (values >> i) & 1);
+        }
+    }
+    robot.SetDigitalOutputs(outputs);
+}
+
+/**
+ * @struct DigitalEdges
+ * @brief Edges of digital input ports detected by DigitalEdgeDetector.
+ */
+struct DigitalEdges
+{
+    /** Bitmask of the ports that changed from low to high */
+    uint32_t rising = {};
+
+    /** Bitmask of the ports that changed from high to low */
+    uint32_t falling = {};
+
+    /** Bitmask of all port readings in which the edges are detected */
+    uint32_t inputs = {};
+
+    /** Time of the readings in [inputs] */
+    std::chrono::steady_clock::time_point time = {};
+};
+
+/**
+ * @class DigitalEdgeDetector
+ * @brief Detects edges between consecutive readings of digital input ports, e.g. called once per
+ * cycle from an rdk::Scheduler task with DigitalInputsMask().
+ */
+class DigitalEdgeDetector
+{
+public:
+    /**
+     * @brief [Non-blocking] Compare a reading with the previous one.
+     * @param[in] inputs Bitmask of the current port readings.
+     * @param[in] time Time of the current readings.
+     * @return Detected edges. No edge is reported for the first reading after construction or
+     * Reset().
+     * @note Real-time (RT).
+     */
+    DigitalEdges Update(uint32_t inputs,
+        std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now())
+    {
+        DigitalEdges edges;
+        edges.inputs = inputs;
+        edges.time = time;
+        if (has_prev_) {
+            edges.rising = inputs & ~prev_;
+            edges.falling = prev_ & ~inputs;
+        }
+        prev_ = inputs;
+        has_prev_ = true;
+        return edges;
+    }
+
+    /**
+     * @brief [Non-blocking] Forget the previous reading.
+     * @note Real-time (RT).
+     */
+    void Reset() { has_prev_ = false; }
+
+private:
+    uint32_t prev_ = 0;
+    bool has_prev_ = false;
+};
+
+/**
+ * @class DigitalInputMonitor
+ * @brief Polls the digital input ports in a background thread and invokes a callback on each edge
+ * of the watched ports, so application threads can react to inputs without polling
+ * Robot::digital_inputs() themselves.
+ * @note Edges are time-stamped at the poll in which they are detected, so the time stamp lags the
+ * actual edge by up to one poll interval plus the state update latency of the robot.
+ * @note A failed poll does not stop the monitor. Polling continues with an increasing interval of
+ * up to kMaxRetryInterval, and fault() reports the failure until a poll succeeds. Changes during
+ * the failed polls are reported as edges of the first successful poll.
+ * @note An exception thrown by the callback does not stop the monitor either, see
+ * callback_error_message().
+ */
+class DigitalInputMonitor
+{
+public:
+    /** Maximum interval between two polls while polling keeps failing [ms] */
+    static constexpr unsigned int kMaxRetryInterval = 1000;
+
+    /**
+     * @brief Callback invoked on edges of the watched ports.
+     */
+    using Callback = std::function<void(const DigitalEdges& edges)>;
+
+    /**
+     * @brief [Non-blocking] Instantiate the monitor and start its background polling thread.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+     * @param[in] callback Callback invoked in the polling thread when any watched port changes.
+     * Keep it short, as it delays the next poll. Exceptions thrown by it are caught, see
+     * callback_error_message().
+     * @param[in] ports Bitmask of the input ports to watch.
+     * @param[in] poll_interval Interval between two polls of Robot::digital_inputs() [ms].
+     * @throw std::invalid_argument if [callback] is null, [ports] selects no port or ports beyond
+     * kIOPorts, or [poll_interval] is 0.
+     * @note The instance of flexiv::rdk::Robot must outlive this instance.
+     */
+    DigitalInputMonitor(const Robot& robot, Callback callback, uint32_t ports = kIOPortsMask,
+        unsigned int poll_interval = 1)
+    : robot_(robot)
+    , callback_(std::move(callback))
+    , ports_(ports)
+    , poll_interval_(poll_interval)
+    {
+        if (!callback_) {
+            throw std::invalid_argument("DigitalInputMonitor: [callback] cannot be null");
+        }
+        if (ports == 0 || (ports & ~kIOPortsMask)) {
+            throw std::invalid_argument("DigitalInputMonitor: [ports] is invalid");
+        }
+        if (poll_interval == 0) {
+            throw std::invalid_argument("DigitalInputMonitor: [poll_interval] cannot be 0");
+        }
+        poller_ = std::thread([this]() { Run(); });
+    }
+
+    /**
+     * @brief [Blocking] Stop the background polling thread, blocks for up to one poll.
+     */
+    virtual ~DigitalInputMonitor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        poller_.join();
+    }
+
+    DigitalInputMonitor(const DigitalInputMonitor&) = delete;
+    DigitalInputMonitor& operator=(const DigitalInputMonitor&) = delete;
+
+    /**
+     * @brief [Non-blocking] Bitmask of the latest successfully polled input port readings,
+     * including ports that are not watched. 0 before the first successful poll.
+     */
+    uint32_t inputs() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return inputs_;
+    }
+
+    /**
+     * @brief [Non-blocking] Whether the latest poll of the digital inputs failed, see
+     * error_message(). Cleared once a poll succeeds.
+     */
+    bool fault() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !error_message_.empty();
+    }
+
+    /**
+     * @brief [Non-blocking] Reason of failure of the latest poll, empty if fault() is false.
+     */
+    std::string error_message() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_message_;
+    }
+
+    /**
+     * @brief [Non-blocking] Message of the latest exception thrown by the callback, empty if it has
+     * never thrown. The edges it was invoked with are not reported again.
+     */
+    std::string callback_error_message() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return callback_error_message_;
+    }
+
+private:
+    void Run()
+    {
+        DigitalEdgeDetector detector;
+        unsigned int interval = poll_interval_;
+        while (true) {
+            // Poll failures and callback exceptions are caught separately, so that an exception
+            // thrown by the callback is not taken as a failed poll
+            DigitalEdges edges;
+            bool polled = false;
+            std::string error;
+            try {
+                edges = detector.Update(DigitalInputsMask(robot_));
+                polled = true;
+            } catch (const std::exception& e) {
+                error = e.what();
+            } catch (...) {
+            }
+
+            if (polled) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    inputs_ = edges.inputs;
+                    error_message_.clear();
+                }
+                interval = poll_interval_;
+                edges.rising &= ports_;
+                edges.falling &= ports_;
+                if (edges.rising || edges.falling) {
+                    try {
+                        callback_(edges);
+                    } catch (const std::exception& e) {
+                        SetCallbackError(e.what());
+                    } catch (...) {
+                        SetCallbackError("Unknown error");
+                    }
+                }
+            } else {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    error_message_ = error.empty() ? "Unknown error" : error;
+                }
+                // Back off until a poll succeeds again
+                interval = std::min(interval * 2, std::max(kMaxRetryInterval, poll_interval_));
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (cv_.wait_for(
+                    lock, std::chrono::milliseconds(interval), [this]() { return stop_; })) {
+                return;
+            }
+        }
+    }
+
+    void SetCallbackError(const std::string& message)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback_error_message_ = message.empty() ? "Unknown error" : message;
+    }
+
+    const Robot& robot_;
+    const Callback callback_;
+    const uint32_t ports_;
+    const unsigned int poll_interval_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t inputs_ = 0;
+    std::string error_message_;
+    std::string callback_error_message_;
+    bool stop_ = false;
+    std::thread poller_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_DIGITAL_IO_HPP_ */
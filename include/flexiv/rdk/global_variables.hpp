@@ -0,0 +1,173 @@
+/**
+ * @file global_variables.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_GLOBAL_VARIABLES_HPP_
+#define FLEXIV_RDK_GLOBAL_VARIABLES_HPP_
+
+#include "robot.hpp"
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class GlobalVariables
+ * @brief ID-indexed local cache of selected global variables of the robot. Variable names are
+ * resolved to IDs once at construction. Values are written locally by ID and only the changed ones
+ * are sent to the robot in one request, and changed values are reported by ID when pulling from
+ * the robot.
+ * @warning This class is not thread-safe.
+ * @see Robot::SetGlobalVariables(), Robot::global_variables().
+ */
+class GlobalVariables
+{
+public:
+    /**
+     * @brief [Non-blocking] Instantiate the cache. Call Pull() to fill it with the robot's values.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+     * @param[in] names Names of the global variables to cache, which need to be created first
+     * using Flexiv Elements.
+     * @throw std::invalid_argument if [names] contains duplicates.
+     * @note The instance of flexiv::rdk::Robot must outlive this instance.
+     */
+    GlobalVariables(Robot& robot, const std::vector<std::string>& names)
+    : robot_(robot)
+    , names_(names)
+    , values_(names.size())
+    , valid_(names.size(), false)
+    , dirty_(names.size(), false)
+    {
+        for (size_t i = 0; i < names.size(); i++) {
+            if (!ids_.emplace(names[i], i).second) {
+                throw std::invalid_argument(
+                    "GlobalVariables: Name [" + names[i] + "] is duplicate");
+            }
+        }
+    }
+    virtual ~GlobalVariables() = default;
+
+    /**
+     * @brief [Non-blocking] ID of a cached global variable, resolve once and use it for the other
+     * functions.
+     * @param[in] name Name of the global variable.
+     * @return ID of the global variable.
+     * @throw std::out_of_range if [name] is not cached.
+     */
+    size_t id(const std::string& name) const { return ids_.at(name); }
+
+    /**
+     * @brief [Non-blocking] Name of a cached global variable.
+     * @param[in] id ID of the global variable, see id().
+     * @throw std::out_of_range if [id] is invalid.
+     */
+    const std::string& name(size_t id) const { return names_.at(id); }
+
+    /**
+     * @brief [Non-blocking] Locally cached value of a global variable, i.e. the value from the
+     * last Pull() or Set(), whichever is later. Holds int 0 before either is called.
+     * @param[in] id ID of the global variable, see id().
+     * @return Reference to the cached value, valid until the next Pull() or Set().
+     * @throw std::out_of_range if [id] is invalid.
+     */
+    const FlexivDataTypes& value(size_t id) const { return values_.at(id); }
+
+    /**
+     * @brief [Non-blocking] Set value of a global variable locally, to be sent by the next Push().
+     * @param[in] id ID of the global variable, see id().
+     * @param[in] value New value. Use int 1 and 0 to represent booleans.
+     * @throw std::out_of_range if [id] is invalid.
+     * @note Setting the same value as the cached one does not mark the variable as changed.
+     */
+    void Set(size_t id, const FlexivDataTypes& value)
+    {
+        auto& cached = values_.at(id);
+        if (!valid_[id] || cached != value) {
+            cached = value;
+            valid_[id] = true;
+            dirty_[id] = true;
+        }
+    }
+
+    /**
+     * @brief [Blocking] Send the global variables changed by Set() since the last Push() to the
+     * robot in one request. No request is sent if nothing has changed.
+     * @return Number of global variables sent.
+     * @throw std::length_error if too many changed global variables to transmit in one request.
+     * @throw std::invalid_argument if any of the changed global variables does not exist.
+     * @throw std::runtime_error if failed to deliver the request to the connected robot.
+     * @note This function blocks until the global variables are successfully set.
+     * @note If an exception is thrown, the changed global variables remain marked as changed.
+     */
+    size_t Push()
+    {
+        std::map<std::string, FlexivDataTypes> changed;
+        for (size_t i = 0; i < names_.size(); i++) {
+            if (dirty_[i]) {
+                changed.emplace(names_[i], values_[i]);
+            }
+        }
+        if (changed.empty()) {
+            return 0;
+        }
+        robot_.SetGlobalVariables(changed);
+        dirty_.assign(dirty_.size(), false);
+        return changed.size();
+    }
+
+    /**
+     * @brief [Blocking] Get current values of the cached global variables from the robot.
+     * @return IDs of the global variables whose values differ from the cached ones, in ascending
+     * order. The first call returns all IDs except the ones changed by Set() before it, as the
+     * cache holds no value from the robot yet.
+     * @throw std::invalid_argument if any of the cached global variables does not exist.
+     * @throw std::runtime_error if failed to get a reply from the connected robot.
+     * @note This function blocks until a reply is received.
+     * @note Global variables changed by Set() but not yet pushed keep their local values and are
+     * not reported.
+     * @note If an exception is thrown, the cache is left unchanged.
+     */
+    std::vector<size_t> Pull()
+    {
+        const auto global_vars = robot_.global_variables();
+
+        // Collect the new values in a temporary, so that the cache is not touched if any throws
+        std::vector<size_t> changed;
+        std::vector<FlexivDataTypes> updates;
+        for (size_t i = 0; i < names_.size(); i++) {
+            auto it = global_vars.find(names_[i]);
+            if (it == global_vars.end()) {
+                throw std::invalid_argument(
+                    "GlobalVariables::Pull: Global variable [" + names_[i] + "] does not exist");
+            }
+            if (!dirty_[i] && (!valid_[i] || values_[i] != it->second)) {
+                changed.push_back(i);
+                updates.push_back(it->second);
+            }
+        }
+
+        // Commit, swapping does not throw
+        for (size_t k = 0; k < changed.size(); k++) {
+            values_[changed[k]].swap(updates[k]);
+            valid_[changed[k]] = true;
+        }
+        return changed;
+    }
+
+private:
+    Robot& robot_;
+    const std::vector<std::string> names_;
+    std::map<std::string, size_t> ids_;
+    std::vector<FlexivDataTypes> values_;
+    std::vector<bool> valid_;
+    std::vector<bool> dirty_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_GLOBAL_VARIABLES_HPP_ */
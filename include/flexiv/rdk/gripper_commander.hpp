@@ -0,0 +1,204 @@
+/**
+ * @file gripper_commander.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_GRIPPER_COMMANDER_HPP_
+#define FLEXIV_RDK_GRIPPER_COMMANDER_HPP_
+
+#include "gripper.hpp"
+#include "spsc_queue.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class GripperCommander
+ * @brief Fire-and-forget front end of rdk::Gripper for real-time loops. Grasp(), Move() and Stop()
+ * only queue the command and return immediately, and a background thread delivers it with the
+ * blocking rdk::Gripper functions. Commands that are superseded by a newer one before being
+ * delivered are skipped, so the gripper always receives the latest intent. Read the gripper
+ * feedback with Gripper::states() in the same loop, which is non-blocking.
+ * @note Commands must be issued from one thread at a time, e.g. one rdk::Scheduler task.
+ */
+class GripperCommander
+{
+public:
+    /** Maximum number of commands waiting to be delivered */
+    static constexpr size_t kQueueSize = 64;
+
+    /**
+     * @brief [Non-blocking] Instantiate the commander and start its background delivery thread.
+     * @param[in] gripper Reference to the instance of flexiv::rdk::Gripper to deliver commands to.
+     * The gripper must be enabled before commands are issued.
+     * @param[in] poll_interval Sleep time of the delivery thread when no command is queued [ms].
+     * @throw std::invalid_argument if [poll_interval] is 0.
+     * @note The instance of flexiv::rdk::Gripper must outlive this instance.
+     */
+    GripperCommander(Gripper& gripper, unsigned int poll_interval = 1)
+    : gripper_(gripper)
+    , poll_interval_(poll_interval)
+    , queue_(std::make_unique<SPSCQueue<Command, kQueueSize>>())
+    {
+        if (poll_interval == 0) {
+            throw std::invalid_argument("GripperCommander: [poll_interval] cannot be 0");
+        }
+        worker_ = std::thread([this]() { Deliver(); });
+    }
+
+    /**
+     * @brief [Blocking] Deliver the latest queued command, then stop the background delivery
+     * thread.
+     */
+    virtual ~GripperCommander()
+    {
+        stop_ = true;
+        worker_.join();
+    }
+
+    GripperCommander(const GripperCommander&) = delete;
+    GripperCommander& operator=(const GripperCommander&) = delete;
+
+    /**
+     * @brief [Non-blocking] Queue a direct force control grasp, see Gripper::Grasp().
+     * @param[in] force Target gripping force. Positive: closing force, negative: opening force [N].
+     * @return True if queued, false if the queue is full.
+     * @note Real-time (RT).
+     */
+    bool Grasp(double force) { return Enqueue({Type::GRASP, 0.0, 0.0, force}); }
+
+    /**
+     * @brief [Non-blocking] Queue a position control move, see Gripper::Move().
+     * @param[in] width Target opening width [m].
+     * @param[in] velocity Closing/opening velocity [m/s].
+     * @param[in] force_limit Maximum contact force during movement [N].
+     * @return True if queued, false if the queue is full.
+     * @note Real-time (RT).
+     */
+    bool Move(double width, double velocity, double force_limit)
+    {
+        return Enqueue({Type::MOVE, width, velocity, force_limit});
+    }
+
+    /**
+     * @brief [Non-blocking] Queue a stop that holds the current finger width, see Gripper::Stop().
+     * @return True if queued, false if the queue is full.
+     * @note Real-time (RT).
+     */
+    bool Stop() { return Enqueue({Type::STOP, 0.0, 0.0, 0.0}); }
+
+    /**
+     * @brief [Non-blocking] Number of commands delivered to the gripper.
+     */
+    uint64_t num_delivered() const { return num_delivered_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Number of commands skipped because a newer one was queued before they
+     * were delivered.
+     */
+    uint64_t num_superseded() const { return num_superseded_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Whether delivering the latest command failed, see error_message().
+     * Cleared once a later command is delivered successfully.
+     * @note Real-time (RT).
+     */
+    bool fault() const { return fault_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief [Non-blocking] Message of the error of the latest failed delivery, empty if fault() is
+     * false.
+     */
+    std::string error_message() const
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        return fault() ? error_message_ : "";
+    }
+
+private:
+    enum class Type
+    {
+        GRASP,
+        MOVE,
+        STOP,
+    };
+
+    struct Command
+    {
+        Type type = Type::STOP;
+        double width = 0.0;
+        double velocity = 0.0;
+        double force = 0.0;
+    };
+
+    bool Enqueue(const Command& command) { return queue_->Push(command); }
+
+    void Deliver()
+    {
+        while (true) {
+            // Check the stop flag before draining, so that the last command is always delivered
+            const bool stopping = stop_;
+            Command command;
+            bool has_command = false;
+            while (queue_->Pop(command)) {
+                if (has_command) {
+                    num_superseded_.fetch_add(1, std::memory_order_relaxed);
+                }
+                has_command = true;
+            }
+            if (has_command) {
+                Execute(command);
+            } else if (stopping) {
+                return;
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_));
+            }
+        }
+    }
+
+    void Execute(const Command& command)
+    {
+        try {
+            switch (command.type) {
+                case Type::GRASP:
+                    gripper_.Grasp(command.force);
+                    break;
+                case Type::MOVE:
+                    gripper_.Move(command.width, command.velocity, command.force);
+                    break;
+                case Type::STOP:
+                    gripper_.Stop();
+                    break;
+            }
+            num_delivered_.fetch_add(1, std::memory_order_relaxed);
+            fault_.store(false, std::memory_order_release);
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            error_message_ = e.what();
+            fault_.store(true, std::memory_order_release);
+        }
+    }
+
+    Gripper& gripper_;
+    const unsigned int poll_interval_;
+    std::unique_ptr<SPSCQueue<Command, kQueueSize>> queue_;
+    std::atomic<uint64_t> num_delivered_ = {0};
+    std::atomic<uint64_t> num_superseded_ = {0};
+    std::atomic<bool> fault_ = {false};
+    mutable std::mutex error_mutex_;
+    std::string error_message_;
+    std::atomic<bool> stop_ = {false};
+    std::thread worker_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_GRIPPER_COMMANDER_HPP_ */
@@ -0,0 +1,208 @@
+/**
+ * @file player_core.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_PLAYER_CORE_HPP_
+#define FLEXIV_RDK_PLAYER_CORE_HPP_
+
+#include "robot.hpp"
+#include "scheduler.hpp"
+#include "spsc_queue.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class PlayerCore
+ * @brief Scaffolding shared by the players that stream commands from an internal 1 kHz real-time
+ * task, e.g. JointTrajectoryPlayer and CartesianSetpointPlayer: the real-time task and its
+ * start/stop, the wait-free queue of items submitted from one non-real-time thread, the underrun
+ * counter and the fault state. The owning player supplies the work of each cycle and keeps its own
+ * interpolation state.
+ * @tparam Item Type of the items submitted to the player.
+ * @tparam BufferSize Maximum number of items that can be buffered ahead, must be a power of 2.
+ * @warning Declare it as the last data member of the owning player, so that the real-time task is
+ * stopped before the other data members used by it are destroyed.
+ */
+template <typename Item, size_t BufferSize>
+class PlayerCore
+{
+public:
+    /** Period of the internal real-time task. Unit: \f$ [s] \f$ */
+    static constexpr double kPeriod = 0.001;
+
+    /**
+     * @brief [Blocking] Instantiate the internal real-time scheduler.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot to stream commands to.
+     * @param[in] name Name of the owning player, used for the task and in error messages. Must be a
+     * string literal.
+     * @param[in] cycle Work of each cycle, e.g. interpolate and stream one command. Exceptions
+     * thrown by it stop the streaming, see fault().
+     * @param[in] cpu_affinity CPU core for the internal real-time task thread to bind to, see
+     * Scheduler::AddTask().
+     * @throw std::runtime_error if the scheduler initialization sequence failed.
+     * @throw std::invalid_argument if [cpu_affinity] is invalid.
+     */
+    PlayerCore(Robot& robot, const char* name, std::function<void()> cycle, int cpu_affinity)
+    : robot_(robot)
+    , name_(name)
+    , cycle_(std::move(cycle))
+    , queue_(std::make_unique<SPSCQueue<Item, BufferSize>>())
+    {
+        scheduler_.AddTask(
+            [this]() { Step(); }, name_, 1, scheduler_.max_priority(), cpu_affinity);
+    }
+
+    /**
+     * @brief [Blocking] Stop the internal real-time task if it is running.
+     */
+    virtual ~PlayerCore()
+    {
+        if (running_) {
+            try {
+                scheduler_.Stop();
+            } catch (...) {
+            }
+        }
+    }
+
+    PlayerCore(const PlayerCore&) = delete;
+    PlayerCore& operator=(const PlayerCore&) = delete;
+
+    /**
+     * @brief [Blocking] Start the internal real-time task. Items left over from a previous run are
+     * discarded, the fault is cleared, and a reset is requested from the submitting thread, see
+     * TakeReset().
+     * @param[in] reset Resets the interpolation state of the owning player before the task starts,
+     * and throws if the player cannot start, e.g. in a wrong control mode.
+     * @throw std::logic_error if already started.
+     * @throw std::runtime_error if failed to start the internal real-time task.
+     */
+    void Start(const std::function<void()>& reset)
+    {
+        if (running_) {
+            throw std::logic_error(std::string(name_) + "::Start: Already started");
+        }
+        reset();
+        Item discarded;
+        while (queue_->Pop(discarded)) {
+        }
+        reset_requested_.store(true, std::memory_order_release);
+        error_message_.fill('\0');
+        fault_ = false;
+        scheduler_.Start();
+        running_ = true;
+    }
+
+    /**
+     * @brief [Blocking] Stop the internal real-time task.
+     * @throw std::logic_error if not started yet.
+     * @throw std::runtime_error if failed to stop the internal real-time task.
+     */
+    void Stop()
+    {
+        if (!running_) {
+            throw std::logic_error(std::string(name_) + "::Stop: Not started yet");
+        }
+        scheduler_.Stop();
+        running_ = false;
+    }
+
+    /**
+     * @brief [Non-blocking] Whether Start() was called since the last call. Called by the
+     * submitting thread, which then forgets the items it submitted before, so that its state is
+     * never touched by another thread.
+     */
+    bool TakeReset() { return reset_requested_.exchange(false, std::memory_order_acq_rel); }
+
+    /**
+     * @brief [Non-blocking] Buffer an item. Called by the submitting thread.
+     * @return True if buffered, false if the buffer is full.
+     */
+    bool Push(const Item& item) { return queue_->Push(item); }
+
+    /**
+     * @brief [Non-blocking] Take the oldest buffered item. Called by the real-time task.
+     * @return True if an item was taken, false if the buffer is empty.
+     * @note Real-time (RT).
+     */
+    bool Pop(Item& item) { return queue_->Pop(item); }
+
+    /**
+     * @brief [Non-blocking] Count a cycle in which the submitted items ran out. Called by the
+     * real-time task.
+     * @note Real-time (RT).
+     */
+    void CountUnderrun() { num_underruns_.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Number of items buffered and not taken yet.
+     */
+    size_t num_buffered() const { return queue_->size(); }
+
+    /**
+     * @brief [Non-blocking] Number of cycles counted by CountUnderrun().
+     */
+    uint64_t num_underruns() const { return num_underruns_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Whether the internal real-time task has stopped streaming due to an
+     * error, e.g. robot fault or command rejected. Cleared by Start().
+     */
+    bool fault() const { return fault_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief [Non-blocking] Message of the error that stopped streaming, empty if fault() is false.
+     */
+    std::string error_message() const { return fault() ? std::string(error_message_.data()) : ""; }
+
+private:
+    void Step()
+    {
+        if (fault_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (robot_.fault()) {
+            SetFault("Fault occurred on the connected robot");
+            return;
+        }
+        try {
+            cycle_();
+        } catch (const std::exception& e) {
+            SetFault(e.what());
+        }
+    }
+
+    void SetFault(const char* message)
+    {
+        std::snprintf(error_message_.data(), error_message_.size(), "%s: %s", name_, message);
+        fault_.store(true, std::memory_order_release);
+    }
+
+    Robot& robot_;
+    const char* const name_;
+    const std::function<void()> cycle_;
+    Scheduler scheduler_;
+    bool running_ = false;
+
+    std::unique_ptr<SPSCQueue<Item, BufferSize>> queue_;
+    std::atomic<bool> reset_requested_ = {false};
+    std::atomic<uint64_t> num_underruns_ = {0};
+    std::atomic<bool> fault_ = {false};
+    std::array<char, 256> error_message_ = {};
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_PLAYER_CORE_HPP_ */
@@ -0,0 +1,272 @@
+/**
+ * @file primitive_monitor.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_PRIMITIVE_MONITOR_HPP_
+#define FLEXIV_RDK_PRIMITIVE_MONITOR_HPP_
+
+#include "robot.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class PrimitiveStateMonitor
+ * @brief Watches selected primitive states in a background thread and notifies on change, so
+ * sequencer threads can wait for a primitive state (e.g. [reachedTarget]) without polling
+ * Robot::primitive_states() themselves. The watched keys are resolved to indices once at
+ * construction, so reading or waiting on a watched state involves no lookup by name.
+ * @note There is a single background thread that polls Robot::primitive_states() at the given
+ * interval, regardless of how many threads are waiting.
+ * @note A failed poll does not stop the monitor. Polling continues with an increasing interval of
+ * up to kMaxRetryInterval, and fault() reports the failure until a poll succeeds.
+ */
+class PrimitiveStateMonitor
+{
+public:
+    /** Maximum interval between two polls while polling keeps failing [ms] */
+    static constexpr unsigned int kMaxRetryInterval = 1000;
+
+    /**
+     * @brief Callback invoked on change of a watched state, with index of the state and its new
+     * value.
+     */
+    using Callback = std::function<void(size_t index, const FlexivDataTypes& value)>;
+
+    /**
+     * @brief [Non-blocking] Instantiate the monitor and start its background polling thread.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+     * @param[in] keys Names of the primitive states to watch, e.g. {"reachedTarget"}.
+     * @param[in] poll_interval Interval between two polls of Robot::primitive_states() [ms].
+     * @param[in] callback Optional callback invoked in the polling thread on change of any watched
+     * state. Keep it short, as it delays the next poll.
+     * @throw std::invalid_argument if [keys] is empty or contains duplicates, or [poll_interval] is
+     * 0.
+     * @note The instance of flexiv::rdk::Robot must outlive this instance.
+     */
+    PrimitiveStateMonitor(const Robot& robot, const std::vector<std::string>& keys,
+        unsigned int poll_interval = 10, Callback callback = nullptr)
+    : robot_(robot)
+    , keys_(keys)
+    , poll_interval_(poll_interval)
+    , callback_(std::move(callback))
+    , values_(keys.size())
+    , present_(keys.size(), false)
+    {
+        if (keys.empty()) {
+            throw std::invalid_argument("PrimitiveStateMonitor: [keys] cannot be empty");
+        }
+        if (poll_interval == 0) {
+            throw std::invalid_argument("PrimitiveStateMonitor: [poll_interval] cannot be 0");
+        }
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (!indices_.emplace(keys[i], i).second) {
+                throw std::invalid_argument(
+                    "PrimitiveStateMonitor: Key [" + keys[i] + "] is duplicate");
+            }
+        }
+        poller_ = std::thread([this]() { Run(); });
+    }
+
+    /**
+     * @brief [Blocking] Stop the background polling thread, blocks for up to one poll.
+     */
+    virtual ~PrimitiveStateMonitor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        poller_.join();
+    }
+
+    PrimitiveStateMonitor(const PrimitiveStateMonitor&) = delete;
+    PrimitiveStateMonitor& operator=(const PrimitiveStateMonitor&) = delete;
+
+    /**
+     * @brief [Non-blocking] Index of a watched state, resolve once and use it for the other
+     * functions.
+     * @param[in] key Name of the watched state.
+     * @return Index of the watched state.
+     * @throw std::out_of_range if [key] is not watched.
+     */
+    size_t index(const std::string& key) const { return indices_.at(key); }
+
+    /**
+     * @brief [Non-blocking] Latest polled value of a watched state.
+     * @param[in] index Index of the watched state, see index().
+     * @param[out] value Latest polled value, copied under the monitor's lock. Copying a string or
+     * vector value allocates unless [value] already holds one with enough capacity.
+     * @return True if the state is present in the latest polled primitive states, false if not, in
+     * which case [value] is unchanged.
+     * @throw std::out_of_range if [index] is invalid.
+     */
+    bool value(size_t index, FlexivDataTypes& value) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CheckIndex(index);
+        if (!present_[index]) {
+            return false;
+        }
+        value = values_[index];
+        return true;
+    }
+
+    /**
+     * @brief [Blocking] Wait until a watched state has the expected value.
+     * @param[in] index Index of the watched state, see index().
+     * @param[in] expected Expected value, e.g. int(1) for [reachedTarget].
+     * @param[in] timeout Maximum time to wait [ms]. Set 0 to wait without a timeout.
+     * @return True if the expected value is reached, false if timed out.
+     * @throw std::out_of_range if [index] is invalid.
+     * @note Call Invalidate() right after commanding a new primitive, so that a stale value polled
+     * from the previous primitive is not mistaken as the result of the new one.
+     * @note While polling fails, the watched value is not updated and this function keeps waiting,
+     * check fault() when it times out.
+     */
+    bool WaitFor(size_t index, const FlexivDataTypes& expected, unsigned int timeout = 0) const
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        CheckIndex(index);
+        auto done = [&]() { return stop_ || (present_[index] && values_[index] == expected); };
+        if (timeout == 0) {
+            cv_.wait(lock, done);
+            return !stop_;
+        }
+        return cv_.wait_for(lock, std::chrono::milliseconds(timeout), done) && !stop_;
+    }
+
+    /**
+     * @brief [Non-blocking] Mark all watched states as not present until they are polled again by
+     * a poll that starts after this call. Results of a poll already in progress are discarded.
+     */
+    void Invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        present_.assign(present_.size(), false);
+        generation_++;
+    }
+
+    /**
+     * @brief [Non-blocking] Whether the latest poll of Robot::primitive_states() failed, see
+     * error_message(). Cleared once a poll succeeds.
+     */
+    bool fault() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !error_message_.empty();
+    }
+
+    /**
+     * @brief [Non-blocking] Reason of failure of the latest poll, empty if fault() is false.
+     */
+    std::string error_message() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_message_;
+    }
+
+private:
+    void CheckIndex(size_t index) const
+    {
+        if (index >= keys_.size()) {
+            throw std::out_of_range(
+                "PrimitiveStateMonitor: Index [" + std::to_string(index) + "] is invalid");
+        }
+    }
+
+    void Run()
+    {
+        std::vector<size_t> changed;
+        changed.reserve(keys_.size());
+        unsigned int interval = poll_interval_;
+        while (true) {
+            // Results of this poll only count if no Invalidate() happens before they are stored
+            uint64_t generation = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                generation = generation_;
+            }
+            try {
+                const auto states = robot_.primitive_states();
+                changed.clear();
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    error_message_.clear();
+                    if (generation == generation_) {
+                        for (size_t i = 0; i < keys_.size(); i++) {
+                            auto it = states.find(keys_[i]);
+                            if (it == states.end()) {
+                                present_[i] = false;
+                                continue;
+                            }
+                            if (!present_[i] || values_[i] != it->second) {
+                                values_[i] = it->second;
+                                present_[i] = true;
+                                changed.push_back(i);
+                            }
+                        }
+                    }
+                }
+                interval = poll_interval_;
+                if (!changed.empty()) {
+                    cv_.notify_all();
+                    if (callback_) {
+                        for (auto i : changed) {
+                            callback_(i, states.at(keys_[i]));
+                        }
+                    }
+                }
+            } catch (const std::exception& e) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    error_message_ = e.what();
+                    if (error_message_.empty()) {
+                        error_message_ = "Unknown error";
+                    }
+                }
+                // Back off until a poll succeeds again
+                interval = std::min(interval * 2, std::max(kMaxRetryInterval, poll_interval_));
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (cv_.wait_for(
+                    lock, std::chrono::milliseconds(interval), [this]() { return stop_; })) {
+                return;
+            }
+        }
+    }
+
+    const Robot& robot_;
+    const std::vector<std::string> keys_;
+    const unsigned int poll_interval_;
+    const Callback callback_;
+    std::map<std::string, size_t> indices_;
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    std::vector<FlexivDataTypes> values_;
+    std::vector<bool> present_;
+    std::string error_message_;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::thread poller_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_PRIMITIVE_MONITOR_HPP_ */
@@ -0,0 +1,433 @@
+/**
+ * @file recorder.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_RECORDER_HPP_
+#define FLEXIV_RDK_RECORDER_HPP_
+
+#include "data.hpp"
+#include "spsc_queue.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/** Maximum number of command values that can be recorded with each sample */
+constexpr size_t kMaxCommandSize = 3 * kMaxJointDoF;
+
+/**
+ * @struct TelemetrySample
+ * @brief One sample recorded by TelemetryRecorder, stored as-is in the binary telemetry files.
+ */
+struct TelemetrySample
+{
+    /** Sequence number of the sample, starting from 0 and increased by 1 for each recorded sample,
+     * including dropped ones. A gap in the recorded sequence numbers indicates dropped samples */
+    uint64_t seq = {};
+
+    /** Time when the sample was recorded, in nanoseconds of the steady clock */
+    int64_t timestamp_ns = {};
+
+    /** Recorded robot states */
+    FixedRobotStates states = {};
+
+    /** Number of valid elements in [command] */
+    size_t command_size = {};
+
+    /** Recorded command values, e.g. the concatenated inputs of the Stream*() function called in
+     * the same cycle. Only the first [command_size] elements are valid */
+    std::array<double, kMaxCommandSize> command = {};
+};
+
+/**
+ * @class TelemetryRecorder
+ * @brief Asynchronous binary recorder for full-rate robot data. The real-time task hands each
+ * sample to the recorder through a lock-free queue, then a background non-real-time thread writes
+ * the samples to binary files in large buffered blocks. The files are rotated by size and
+ * optionally by time, and can be converted to CSV using ConvertToCSV().
+ * @note Binary files store TelemetrySample in the native memory layout, so they should be
+ * converted on a machine with the same architecture as the one that recorded them.
+ */
+class TelemetryRecorder
+{
+public:
+    /**
+     * @brief [Blocking] Instantiate the recorder, open the first file and start the background
+     * writer thread.
+     * @param[in] file_prefix Path prefix of the recorded files. The actual file names are
+     * [file_prefix]_[index].bin, where index starts from 1.
+     * @param[in] max_file_size Rotate to a new file when the current one exceeds this size [byte].
+     * @param[in] max_file_duration Rotate to a new file when the current one has been recorded for
+     * this long [s]. Set 0 to rotate by size only.
+     * @throw std::invalid_argument if [max_file_size] is too small to hold one sample.
+     * @throw std::runtime_error if failed to open the first file.
+     * @note This constructor blocks until the first file is opened.
+     */
+    TelemetryRecorder(const std::string& file_prefix, size_t max_file_size = 512 * 1024 * 1024,
+        unsigned int max_file_duration = 0)
+    : file_prefix_(file_prefix)
+    , max_file_size_(max_file_size)
+    , max_file_duration_(max_file_duration)
+    , queue_(new Queue)
+    , write_buffer_(kWriteBufferSize)
+    {
+        if (max_file_size_ < sizeof(FileHeader) + sizeof(TelemetrySample)) {
+            throw std::invalid_argument(
+                "TelemetryRecorder: [max_file_size] is too small to hold one sample");
+        }
+        if (!OpenNextFile()) {
+            throw std::runtime_error("TelemetryRecorder: Failed to open [" + NextFilePath() + "]");
+        }
+        writer_ = std::thread(&TelemetryRecorder::WriterLoop, this);
+    }
+
+    /**
+     * @brief [Blocking] Write all queued samples, close the current file and stop the background
+     * writer thread.
+     */
+    virtual ~TelemetryRecorder()
+    {
+        stop_ = true;
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+        CloseFile();
+    }
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    /**
+     * @brief [Non-blocking] Record robot states and optionally the command sent in the same cycle.
+     * @param[in] states Robot states to record, e.g. the return value of Robot::states().
+     * @param[in] command Command values to record. Leave empty to record states only.
+     * @return True if the sample is queued, false if it's dropped because the queue is full.
+     * @throw std::invalid_argument if size of [command] exceeds kMaxCommandSize or the robot DoF
+     * exceeds kMaxJointDoF.
+     * @note Real-time (RT). No heap allocation.
+     * @warning Only one thread is allowed to call this function.
+     */
+    bool Record(const RobotStates& states, const std::vector<double>& command = {})
+    {
+        utility::CopyStates(states, sample_.states);
+        return Push(command);
+    }
+
+    /**
+     * @brief [Non-blocking] Record fixed-capacity robot states and optionally the command sent in
+     * the same cycle.
+     * @param[in] states Robot states to record.
+     * @param[in] command Command values to record. Leave empty to record states only.
+     * @return True if the sample is queued, false if it's dropped because the queue is full.
+     * @throw std::invalid_argument if size of [command] exceeds kMaxCommandSize.
+     * @note Real-time (RT). No heap allocation.
+     * @warning Only one thread is allowed to call this function.
+     */
+    bool Record(const FixedRobotStates& states, const std::vector<double>& command = {})
+    {
+        sample_.states = states;
+        return Push(command);
+    }
+
+    /**
+     * @brief [Non-blocking] Number of samples dropped so far because the queue was full.
+     */
+    uint64_t num_dropped() const { return num_dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Number of samples written to files so far.
+     */
+    uint64_t num_written() const { return num_written_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Paths of all files created by this recorder so far.
+     * @return A list of file paths, the last one is the file currently or last written. A file that
+     * failed to be created is not listed. Opening the next file is retried every
+     * kOpenRetryInterval, and samples recorded in the meantime are dropped.
+     */
+    std::vector<std::string> files() const
+    {
+        std::lock_guard<std::mutex> lock(files_mutex_);
+        return files_;
+    }
+
+    /**
+     * @brief [Blocking] Convert a binary file recorded by TelemetryRecorder to CSV format. Each row
+     * contains the sequence number, timestamp, DoF, all joint-space states (n values each), all
+     * Cartesian-space states, then the command values.
+     * @param[in] binary_path Path of the binary file to convert.
+     * @param[in] csv_path Path of the CSV file to create.
+     * @param[in] decimal Decimal places to keep for each floating-point number.
+     * @throw std::runtime_error if failed to open either file, the binary file is not a valid
+     * telemetry file, or its file version differs from the one written by this version of RDK.
+     * @note This function blocks until the whole file is converted.
+     */
+    static void ConvertToCSV(
+        const std::string& binary_path, const std::string& csv_path, size_t decimal = 6)
+    {
+        std::FILE* bin = std::fopen(binary_path.c_str(), "rb");
+        if (!bin) {
+            throw std::runtime_error(
+                "TelemetryRecorder::ConvertToCSV: Failed to open [" + binary_path + "]");
+        }
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> bin_guard(bin, &std::fclose);
+
+        FileHeader header;
+        if (std::fread(&header, sizeof(header), 1, bin) != 1
+            || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+            || header.sample_size != sizeof(TelemetrySample)) {
+            throw std::runtime_error("TelemetryRecorder::ConvertToCSV: [" + binary_path
+                                     + "] is not a valid telemetry file");
+        }
+        if (header.version != kFileVersion) {
+            throw std::runtime_error("TelemetryRecorder::ConvertToCSV: [" + binary_path
+                                     + "] has file version " + std::to_string(header.version)
+                                     + ", but this version of RDK reads version "
+                                     + std::to_string(kFileVersion) + " only");
+        }
+
+        std::ofstream csv(csv_path);
+        if (!csv.is_open()) {
+            throw std::runtime_error(
+                "TelemetryRecorder::ConvertToCSV: Failed to open [" + csv_path + "]");
+        }
+        csv.precision(decimal);
+        csv << std::fixed;
+
+        TelemetrySample sample;
+        bool header_written = false;
+        while (std::fread(&sample, sizeof(sample), 1, bin) == 1) {
+            const auto& s = sample.states;
+            if (!header_written) {
+                WriteCSVHeader(csv, s.DoF, sample.command_size);
+                header_written = true;
+            }
+            csv << sample.seq << "," << sample.timestamp_ns << "," << s.DoF;
+            for (const auto* arr : {&s.q, &s.theta, &s.dq, &s.dtheta, &s.tau, &s.tau_des,
+                     &s.tau_dot, &s.tau_ext}) {
+                for (size_t i = 0; i < s.DoF; i++) {
+                    csv << "," << (*arr)[i];
+                }
+            }
+            WriteCSVValues(csv, s.tcp_pose);
+            WriteCSVValues(csv, s.tcp_vel);
+            WriteCSVValues(csv, s.flange_pose);
+            WriteCSVValues(csv, s.ft_sensor_raw);
+            WriteCSVValues(csv, s.ext_wrench_in_tcp);
+            WriteCSVValues(csv, s.ext_wrench_in_world);
+            WriteCSVValues(csv, s.ext_wrench_in_tcp_raw);
+            WriteCSVValues(csv, s.ext_wrench_in_world_raw);
+            for (size_t i = 0; i < sample.command_size; i++) {
+                csv << "," << sample.command[i];
+            }
+            csv << '\n';
+        }
+    }
+
+private:
+    static_assert(std::is_trivially_copyable<TelemetrySample>::value,
+        "TelemetrySample must be trivially copyable to be stored as raw binary");
+
+    /** Queue capacity, buffers about 4 seconds of samples at 1 kHz */
+    static constexpr size_t kQueueCapacity = 4096;
+
+    /** Size of the stdio buffer used by the writer thread [byte] */
+    static constexpr size_t kWriteBufferSize = 1024 * 1024;
+
+    /** Interval between two attempts to open the next file after one failed [ms] */
+    static constexpr unsigned int kOpenRetryInterval = 1000;
+
+    static constexpr char kMagic[8] = {'F', 'X', 'R', 'D', 'K', 'T', 'L', 'M'};
+    static constexpr uint32_t kFileVersion = 1;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t sample_size;
+    };
+
+    using Queue = SPSCQueue<TelemetrySample, kQueueCapacity>;
+
+    bool Push(const std::vector<double>& command)
+    {
+        if (command.size() > kMaxCommandSize) {
+            throw std::invalid_argument(
+                "TelemetryRecorder::Record: Size of [command] exceeds kMaxCommandSize");
+        }
+        std::copy(command.begin(), command.end(), sample_.command.begin());
+        sample_.command_size = command.size();
+        sample_.seq = next_seq_++;
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        sample_.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+        if (!queue_->Push(sample_)) {
+            num_dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    void WriterLoop()
+    {
+        TelemetrySample sample;
+        while (true) {
+            // Check the stop flag before draining so that no sample queued before it is lost
+            const bool stop = stop_;
+            while (queue_->Pop(sample)) {
+                if (file_ ? NeedRotation() : std::chrono::steady_clock::now() >= retry_time_) {
+                    CloseFile();
+                    // Retry later instead of for every sample, e.g. while the disk is full
+                    if (!OpenNextFile()) {
+                        retry_time_ = std::chrono::steady_clock::now()
+                                      + std::chrono::milliseconds(kOpenRetryInterval);
+                    }
+                }
+                if (file_ && std::fwrite(&sample, sizeof(sample), 1, file_) == 1) {
+                    file_size_ += sizeof(sample);
+                    num_written_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    // Failed to open the rotated file or to write, the sample is lost
+                    num_dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (stop) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    bool NeedRotation() const
+    {
+        if (file_size_ + sizeof(TelemetrySample) > max_file_size_) {
+            return true;
+        }
+        return max_file_duration_ > 0
+               && std::chrono::steady_clock::now() - file_opened_time_
+                      >= std::chrono::seconds(max_file_duration_);
+    }
+
+    std::string NextFilePath() const
+    {
+        return file_prefix_ + "_" + std::to_string(file_index_ + 1) + ".bin";
+    }
+
+    /** Open the next file and write its header, a file that fails to be written is removed */
+    bool OpenNextFile()
+    {
+        const std::string path = NextFilePath();
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_) {
+            return false;
+        }
+        std::setvbuf(file_, write_buffer_.data(), _IOFBF, write_buffer_.size());
+
+        FileHeader header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.sample_size = sizeof(TelemetrySample);
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1 || std::fflush(file_) != 0) {
+            CloseFile();
+            std::remove(path.c_str());
+            return false;
+        }
+
+        file_index_++;
+        file_size_ = sizeof(header);
+        file_opened_time_ = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(files_mutex_);
+            files_.push_back(path);
+        }
+        return true;
+    }
+
+    void CloseFile()
+    {
+        if (file_) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+        file_size_ = 0;
+    }
+
+    static void WriteCSVHeader(std::ostream& csv, size_t dof, size_t command_size)
+    {
+        csv << "seq,timestamp_ns,DoF";
+        for (const char* name :
+            {"q", "theta", "dq", "dtheta", "tau", "tau_des", "tau_dot", "tau_ext"}) {
+            for (size_t i = 0; i < dof; i++) {
+                csv << "," << name << i;
+            }
+        }
+        const std::pair<const char*, size_t> cart_states[] = {{"tcp_pose", kPoseSize},
+            {"tcp_vel", kCartDoF}, {"flange_pose", kPoseSize}, {"ft_sensor_raw", kCartDoF},
+            {"ext_wrench_in_tcp", kCartDoF}, {"ext_wrench_in_world", kCartDoF},
+            {"ext_wrench_in_tcp_raw", kCartDoF}, {"ext_wrench_in_world_raw", kCartDoF}};
+        for (const auto& v : cart_states) {
+            for (size_t i = 0; i < v.second; i++) {
+                csv << "," << v.first << i;
+            }
+        }
+        for (size_t i = 0; i < command_size; i++) {
+            csv << ",command" << i;
+        }
+        csv << '\n';
+    }
+
+    template <size_t N>
+    static void WriteCSVValues(std::ostream& csv, const std::array<double, N>& arr)
+    {
+        for (const auto& v : arr) {
+            csv << "," << v;
+        }
+    }
+
+    // Configurations
+    const std::string file_prefix_;
+    const size_t max_file_size_;
+    const unsigned int max_file_duration_;
+
+    // Producer side, accessed by the real-time thread only
+    TelemetrySample sample_ = {};
+    uint64_t next_seq_ = 0;
+
+    // Shared between producer and writer
+    std::unique_ptr<Queue> queue_;
+    std::atomic<bool> stop_ = {false};
+    std::atomic<uint64_t> num_dropped_ = {0};
+    std::atomic<uint64_t> num_written_ = {0};
+
+    // Writer side, accessed by the writer thread only after construction
+    std::vector<char> write_buffer_;
+    std::FILE* file_ = nullptr;
+    size_t file_size_ = 0;
+    unsigned int file_index_ = 0;
+    std::chrono::steady_clock::time_point file_opened_time_ = {};
+    std::chrono::steady_clock::time_point retry_time_ = {};
+    std::thread writer_;
+
+    mutable std::mutex files_mutex_;
+    std::vector<std::string> files_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_RECORDER_HPP_ */
@@ -0,0 +1,151 @@
+/**
+ * @file request_executor.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_REQUEST_EXECUTOR_HPP_
+#define FLEXIV_RDK_REQUEST_EXECUTOR_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class RequestExecutor
+ * @brief Runs blocking request-reply calls (e.g. Robot::ExecutePlan(), Robot::SwitchMode(),
+ * Tool::Switch()) on a dedicated worker thread and returns a future for each, so the calling thread
+ * is not blocked by the server round trip. Requests submitted to the same executor run one at a
+ * time in submission order. Use one executor per robot to overlap the round trips of several
+ * robots from a single orchestration thread.
+ * @note An exception thrown by a request is stored in its future and rethrown by future::get().
+ * @warning Do not submit non-real-time requests to the executor from a real-time thread, as
+ * submission allocates and locks a mutex.
+ */
+class RequestExecutor
+{
+public:
+    /**
+     * @brief [Non-blocking] Instantiate the executor and start its worker thread.
+     */
+    RequestExecutor()
+    : worker_([this]() { Run(); })
+    {
+    }
+
+    /**
+     * @brief [Blocking] Finish all submitted requests, then stop the worker thread.
+     */
+    virtual ~RequestExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        worker_.join();
+    }
+
+    RequestExecutor(const RequestExecutor&) = delete;
+    RequestExecutor& operator=(const RequestExecutor&) = delete;
+
+    /**
+     * @brief [Non-blocking] Submit a request to run on the worker thread.
+     * @param[in] request Callable object that makes the blocking call, e.g. [&] {
+     * robot.SwitchMode(rdk::Mode::NRT_PLAN_EXECUTION); }.
+     * @return Future of the request's return value.
+     * @throw std::logic_error if the executor is being destroyed.
+     * @par Example
+     * @code
+     * rdk::RequestExecutor executor_a, executor_b;
+     * auto fa = executor_a.Submit([&] { robot_a.ExecutePlan("PLAN-Home"); });
+     * auto fb = executor_b.Submit([&] { robot_b.ExecutePlan("PLAN-Home"); });
+     * fa.get();
+     * fb.get();
+     * @endcode
+     */
+    template <typename F>
+    std::future<decltype(std::declval<F&>()())> Submit(F&& request)
+    {
+        using R = decltype(std::declval<F&>()());
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(request));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) {
+                throw std::logic_error("RequestExecutor::Submit: Executor is being destroyed");
+            }
+            requests_.emplace_back([task]() { (*task)(); });
+        }
+        cv_.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief [Non-blocking] Submit a request to run on the worker thread, and invoke a callback on
+     * the worker thread once the request is done.
+     * @param[in] request Callable object that makes the blocking call.
+     * @param[in] callback Invoked with the future of the request's return value, which is already
+     * ready. Call future::get() inside to obtain the result or the thrown exception.
+     * @throw std::logic_error if the executor is being destroyed.
+     * @warning The callback runs on the worker thread and delays subsequent requests, so keep it
+     * short. An exception thrown by the callback is discarded.
+     */
+    template <typename F, typename Callback>
+    void Submit(F&& request, Callback&& callback)
+    {
+        using R = decltype(std::declval<F&>()());
+        Submit([req = std::forward<F>(request), cb = std::forward<Callback>(callback)]() mutable {
+            std::packaged_task<R()> task(std::move(req));
+            auto future = task.get_future();
+            task();
+            cb(std::move(future));
+        });
+    }
+
+    /**
+     * @brief [Non-blocking] Number of submitted requests that have not started yet.
+     */
+    size_t num_pending() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return requests_.size();
+    }
+
+private:
+    void Run()
+    {
+        while (true) {
+            std::function<void(void)> request;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return stop_ || !requests_.empty(); });
+                if (requests_.empty()) {
+                    return;
+                }
+                request = std::move(requests_.front());
+                requests_.pop_front();
+            }
+            request();
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void(void)>> requests_;
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_REQUEST_EXECUTOR_HPP_ */
@@ -0,0 +1,217 @@
+/**
+ * @file robot_fleet.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_ROBOT_FLEET_HPP_
+#define FLEXIV_RDK_ROBOT_FLEET_HPP_
+
+#include "robot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class RobotFleet
+ * @brief Connects to many robots from one process in parallel, e.g. for a monitoring service that
+ * reads states, event logs and plan info from a whole production line. Each robot is connected by
+ * its own rdk::Robot instance, and the blocking constructors run concurrently on a bounded number
+ * of threads, so connecting the fleet takes about as long as connecting the slowest robots instead
+ * of all robots one after another. A robot that fails to connect does not affect the others.
+ * @note Each robot keeps its own connection and receives its states at the full rate. Read them
+ * with the functions of rdk::Robot at the rate that is needed.
+ */
+class RobotFleet
+{
+public:
+    /**
+     * @brief [Blocking] Connect to all specified robots in parallel.
+     * @param[in] robot_sns Serial numbers of the robots to connect, see Robot::Robot().
+     * @param[in] network_interface_whitelist Network interfaces to use for all robots, see
+     * Robot::Robot().
+     * @param[in] max_parallel Maximum number of robots connecting at the same time.
+     * @param[in] verbose Enable/disable info and warning prints of each rdk::Robot instance.
+     * @throw std::invalid_argument if [robot_sns] is empty or contains duplicates, or
+     * [max_parallel] is 0.
+     * @note A robot that fails to connect does not throw, check connected() and error_message().
+     * @warning This constructor blocks until every robot is either connected or failed.
+     */
+    RobotFleet(const std::vector<std::string>& robot_sns,
+        const std::vector<std::string>& network_interface_whitelist = {}, size_t max_parallel = 8,
+        bool verbose = false)
+    : robot_sns_(robot_sns)
+    , network_interface_whitelist_(network_interface_whitelist)
+    , max_parallel_(max_parallel)
+    , verbose_(verbose)
+    , robots_(robot_sns.size())
+    , error_messages_(robot_sns.size())
+    {
+        if (robot_sns.empty()) {
+            throw std::invalid_argument("RobotFleet: [robot_sns] cannot be empty");
+        }
+        if (max_parallel == 0) {
+            throw std::invalid_argument("RobotFleet: [max_parallel] cannot be 0");
+        }
+        for (size_t i = 0; i < robot_sns.size(); i++) {
+            if (!indices_.emplace(robot_sns[i], i).second) {
+                throw std::invalid_argument(
+                    "RobotFleet: Serial number [" + robot_sns[i] + "] is duplicate");
+            }
+        }
+        std::vector<size_t> all(robot_sns.size());
+        for (size_t i = 0; i < all.size(); i++) {
+            all[i] = i;
+        }
+        Connect(all);
+    }
+
+    virtual ~RobotFleet() = default;
+
+    RobotFleet(const RobotFleet&) = delete;
+    RobotFleet& operator=(const RobotFleet&) = delete;
+
+    /**
+     * @brief [Non-blocking] Number of robots in the fleet, including the ones failed to connect.
+     */
+    size_t size() const { return robot_sns_.size(); }
+
+    /**
+     * @brief [Non-blocking] Index of a robot in the fleet, same as its position in the serial
+     * numbers given to the constructor.
+     * @param[in] robot_sn Serial number of the robot exactly as given to the constructor.
+     * @return Index of the robot.
+     * @throw std::out_of_range if [robot_sn] is not in the fleet.
+     */
+    size_t index(const std::string& robot_sn) const { return indices_.at(robot_sn); }
+
+    /**
+     * @brief [Non-blocking] Serial number of a robot in the fleet.
+     * @throw std::out_of_range if [index] is invalid.
+     */
+    const std::string& serial_number(size_t index) const { return robot_sns_.at(index); }
+
+    /**
+     * @brief [Non-blocking] Whether a robot has been connected and the connection is still alive,
+     * see Robot::connected().
+     * @throw std::out_of_range if [index] is invalid.
+     */
+    bool connected(size_t index) const
+    {
+        const auto& robot = robots_.at(index);
+        return robot && robot->connected();
+    }
+
+    /**
+     * @brief [Non-blocking] Number of robots currently connected, see connected().
+     */
+    size_t num_connected() const
+    {
+        size_t num = 0;
+        for (size_t i = 0; i < size(); i++) {
+            num += connected(i);
+        }
+        return num;
+    }
+
+    /**
+     * @brief [Non-blocking] Reason why a robot failed to connect, empty if it has connected.
+     * @throw std::out_of_range if [index] is invalid.
+     */
+    const std::string& error_message(size_t index) const { return error_messages_.at(index); }
+
+    /**
+     * @brief [Non-blocking] Access the rdk::Robot instance of a connected robot.
+     * @param[in] index Index of the robot, see index().
+     * @return Reference to the rdk::Robot instance.
+     * @throw std::out_of_range if [index] is invalid.
+     * @throw std::logic_error if the robot failed to connect, with the reason of failure.
+     */
+    Robot& robot(size_t index)
+    {
+        auto& robot = robots_.at(index);
+        if (!robot) {
+            throw std::logic_error("RobotFleet::robot: Robot [" + robot_sns_[index]
+                                   + "] is not connected: " + error_messages_[index]);
+        }
+        return *robot;
+    }
+
+    /**
+     * @brief [Blocking] Connect again, in parallel, to the robots that failed to connect or lost
+     * connection.
+     * @return Indices of the robots connected by this call.
+     * @warning The rdk::Robot instances of robots that lost connection are destroyed and replaced,
+     * so references obtained from robot() for those robots become invalid. No other thread may use
+     * them during this call.
+     */
+    std::vector<size_t> Reconnect()
+    {
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < size(); i++) {
+            if (!connected(i)) {
+                robots_[i].reset();
+                pending.push_back(i);
+            }
+        }
+        Connect(pending);
+
+        std::vector<size_t> reconnected;
+        for (auto i : pending) {
+            if (robots_[i]) {
+                reconnected.push_back(i);
+            }
+        }
+        return reconnected;
+    }
+
+private:
+    /** Connect the specified robots on up to [max_parallel_] threads */
+    void Connect(const std::vector<size_t>& indices)
+    {
+        std::atomic<size_t> next = {0};
+        auto work = [&]() {
+            size_t k = 0;
+            while ((k = next.fetch_add(1)) < indices.size()) {
+                const size_t i = indices[k];
+                try {
+                    robots_[i] = std::make_unique<Robot>(
+                        robot_sns_[i], network_interface_whitelist_, verbose_);
+                    error_messages_[i].clear();
+                } catch (const std::exception& e) {
+                    error_messages_[i] = e.what();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        const size_t num_threads = std::min(max_parallel_, indices.size());
+        threads.reserve(num_threads);
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back(work);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    const std::vector<std::string> robot_sns_;
+    const std::vector<std::string> network_interface_whitelist_;
+    const size_t max_parallel_;
+    const bool verbose_;
+    std::map<std::string, size_t> indices_;
+    std::vector<std::unique_ptr<Robot>> robots_;
+    std::vector<std::string> error_messages_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_ROBOT_FLEET_HPP_ */
@@ -0,0 +1,281 @@
+/**
+ * @file rt_logger.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_RT_LOGGER_HPP_
+#define FLEXIV_RDK_RT_LOGGER_HPP_
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/sink.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class RTLogger
+ * @brief Real-time-safe logger. Log messages are formatted into fixed-size records of a
+ * preallocated lock-free queue, then a background thread drains the queue to a target spdlog
+ * logger, so logging from an RT thread never blocks on I/O or on a mutex. The log messages of RDK
+ * itself can also be routed through this logger, see RouteDefaultLogger().
+ * @note Any number of threads can log concurrently. Messages longer than kMaxMessageSize are
+ * truncated. Messages are dropped while the queue is full, see num_dropped().
+ */
+class RTLogger
+{
+public:
+    /** Maximum length of a log message in bytes, longer messages are truncated */
+    static constexpr size_t kMaxMessageSize = 256;
+
+    /** Maximum number of log messages waiting to be drained, must be a power of 2 */
+    static constexpr size_t kQueueSize = 4096;
+
+    /**
+     * @brief [Non-blocking] Instantiate the logger and start its background draining thread.
+     * @param[in] target The spdlog logger to drain log messages to, which can be blocking.
+     * @param[in] drain_interval Sleep time of the draining thread when the queue is empty [ms].
+     * @throw std::invalid_argument if [target] is null or [drain_interval] is 0.
+     */
+    RTLogger(std::shared_ptr<spdlog::logger> target = spdlog::default_logger(),
+        unsigned int drain_interval = 1)
+    : target_(std::move(target))
+    , drain_interval_(drain_interval)
+    , cells_(new Cell[kQueueSize])
+    {
+        if (!target_) {
+            throw std::invalid_argument("RTLogger: [target] cannot be null");
+        }
+        if (drain_interval == 0) {
+            throw std::invalid_argument("RTLogger: [drain_interval] cannot be 0");
+        }
+        for (size_t i = 0; i < kQueueSize; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        drainer_ = std::thread([this]() { Drain(); });
+    }
+
+    /**
+     * @brief [Blocking] Restore the default logger if routed, drain all remaining log messages,
+     * then stop the background draining thread.
+     * @warning Destroy this instance only after all RDK instances that log through the routed
+     * default logger are destroyed.
+     */
+    virtual ~RTLogger()
+    {
+        if (previous_default_) {
+            spdlog::set_default_logger(previous_default_);
+        }
+        stop_ = true;
+        drainer_.join();
+    }
+
+    RTLogger(const RTLogger&) = delete;
+    RTLogger& operator=(const RTLogger&) = delete;
+
+    /**
+     * @brief [Non-blocking] Log a message with the spdlog format syntax, e.g.
+     * Log(spdlog::level::warn, "Loop {} overran by {} us", loop_counter, overrun).
+     * @param[in] level Log level. The message is discarded if the target logger does not log this
+     * level.
+     * @param[in] fmt Format string.
+     * @param[in] args Arguments to format.
+     * @return True if the message is queued or discarded by level, false if dropped due to a full
+     * queue.
+     * @note Real-time (RT), as long as formatting the arguments does not allocate, e.g. built-in
+     * types and string literals.
+     */
+    template <typename... Args>
+    bool Log(spdlog::level::level_enum level, spdlog::format_string_t<Args...> fmt, Args&&... args)
+    {
+        if (!target_->should_log(level)) {
+            return true;
+        }
+        return Enqueue(spdlog::log_clock::now(), level, [&](char* buffer) {
+            return spdlog::fmt_lib::format_to_n(
+                buffer, kMaxMessageSize, fmt, std::forward<Args>(args)...)
+                .size;
+        });
+    }
+
+    /**
+     * @brief [Non-blocking] Log an info message, see Log().
+     * @note Real-time (RT).
+     */
+    template <typename... Args>
+    bool Info(spdlog::format_string_t<Args...> fmt, Args&&... args)
+    {
+        return Log(spdlog::level::info, fmt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief [Non-blocking] Log a warning message, see Log().
+     * @note Real-time (RT).
+     */
+    template <typename... Args>
+    bool Warn(spdlog::format_string_t<Args...> fmt, Args&&... args)
+    {
+        return Log(spdlog::level::warn, fmt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief [Non-blocking] Log an error message, see Log().
+     * @note Real-time (RT).
+     */
+    template <typename... Args>
+    bool Error(spdlog::format_string_t<Args...> fmt, Args&&... args)
+    {
+        return Log(spdlog::level::err, fmt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief [Non-blocking] Replace the spdlog default logger with one that queues all log messages
+     * into this logger, so that log messages of RDK and of spdlog::info() etc. called anywhere in
+     * the program are drained by the background thread as well. The replaced default logger is
+     * restored when this instance is destroyed.
+     * @throw std::logic_error if already routed, or the default logger is already routed by another
+     * RTLogger.
+     * @note Call this function before instantiating the RDK classes, e.g. rdk::Robot.
+     * @warning spdlog still formats the message in the logging thread before queuing it, which may
+     * allocate for messages longer than 250 bytes.
+     */
+    void RouteDefaultLogger()
+    {
+        if (previous_default_) {
+            throw std::logic_error("RTLogger::RouteDefaultLogger: Already routed");
+        }
+        auto current = spdlog::default_logger();
+        for (const auto& sink : current->sinks()) {
+            if (std::dynamic_pointer_cast<QueueSink>(sink)) {
+                throw std::logic_error(
+                    "RTLogger::RouteDefaultLogger: Default logger is already routed elsewhere");
+            }
+        }
+        auto routed = std::make_shared<spdlog::logger>(
+            current->name(), std::make_shared<QueueSink>(*this));
+        routed->set_level(current->level());
+        previous_default_ = current;
+        spdlog::set_default_logger(routed);
+    }
+
+    /**
+     * @brief [Non-blocking] Number of log messages dropped due to a full queue.
+     */
+    uint64_t num_dropped() const { return num_dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence = {0};
+        spdlog::log_clock::time_point time = {};
+        spdlog::level::level_enum level = spdlog::level::info;
+        size_t size = 0;
+        char text[kMaxMessageSize] = {};
+    };
+
+    /** Sink of the routed default logger, queues the formatted payload */
+    class QueueSink : public spdlog::sinks::sink
+    {
+    public:
+        explicit QueueSink(RTLogger& owner)
+        : owner_(owner)
+        {
+        }
+        void log(const spdlog::details::log_msg& msg) override
+        {
+            owner_.Enqueue(msg.time, msg.level, [&](char* buffer) {
+                const size_t size = std::min(msg.payload.size(), kMaxMessageSize);
+                std::memcpy(buffer, msg.payload.data(), size);
+                return msg.payload.size();
+            });
+        }
+        void flush() override {}
+        void set_pattern(const std::string&) override {}
+        void set_formatter(std::unique_ptr<spdlog::formatter>) override {}
+
+    private:
+        RTLogger& owner_;
+    };
+
+    static constexpr size_t kMask = kQueueSize - 1;
+    static_assert((kQueueSize & kMask) == 0, "RTLogger queue size must be a power of 2");
+
+    /** Bounded multi-producer queue with per-cell sequence numbers, see D. Vyukov's MPMC queue */
+    template <typename Writer>
+    bool Enqueue(spdlog::log_clock::time_point time, spdlog::level::level_enum level,
+        Writer&& write)
+    {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &cells_[pos & kMask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                num_dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->time = time;
+        cell->level = level;
+        cell->size = std::min(static_cast<size_t>(write(cell->text)), kMaxMessageSize);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue()
+    {
+        Cell& cell = cells_[dequeue_pos_ & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+            return false;
+        }
+        target_->log(cell.time, spdlog::source_loc {}, cell.level,
+            spdlog::string_view_t(cell.text, cell.size));
+        cell.sequence.store(dequeue_pos_ + kQueueSize, std::memory_order_release);
+        dequeue_pos_++;
+        return true;
+    }
+
+    void Drain()
+    {
+        while (!stop_) {
+            bool drained = false;
+            while (Dequeue()) {
+                drained = true;
+            }
+            if (!drained) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(drain_interval_));
+            }
+        }
+        while (Dequeue()) {
+        }
+        target_->flush();
+    }
+
+    std::shared_ptr<spdlog::logger> target_;
+    std::shared_ptr<spdlog::logger> previous_default_;
+    const unsigned int drain_interval_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> enqueue_pos_ = {0};
+    alignas(64) size_t dequeue_pos_ = 0;
+    std::atomic<uint64_t> num_dropped_ = {0};
+    std::atomic<bool> stop_ = {false};
+    std::thread drainer_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_RT_LOGGER_HPP_ */
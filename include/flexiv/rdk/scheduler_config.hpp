@@ -0,0 +1,193 @@
+/**
+ * @file scheduler_config.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_SCHEDULER_CONFIG_HPP_
+#define FLEXIV_RDK_SCHEDULER_CONFIG_HPP_
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <alloca.h>
+#include <cerrno>
+#include <cstdlib>
+#include <dirent.h>
+#include <malloc.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct SchedulerConfig
+ * @brief Process-wide real-time setup applied by ApplySchedulerConfig(), which removes page-fault
+ * and CPU migration jitter from the tasks of rdk::Scheduler.
+ */
+struct SchedulerConfig
+{
+    /** Lock all current and future memory pages of the process into RAM, including the stacks of
+     * threads created later, e.g. scheduler task threads and RDK internal threads */
+    bool lock_memory = true;
+
+    /** Keep freed heap memory in the process instead of returning it to the OS, so that locked
+     * pages are reused and later allocations do not page-fault */
+    bool disable_heap_trim = true;
+
+    /** Size of the calling thread's stack to touch in advance [bytes], 0 to skip */
+    size_t prefault_stack_size = 512 * 1024;
+
+    /** Size of heap memory to allocate and touch in advance, then keep in the process [bytes], 0
+     * to skip. Only effective if [disable_heap_trim] is true */
+    size_t prefault_heap_size = 0;
+
+    /** CPU cores to bind all existing threads and threads created later to, e.g. RDK internal
+     * threads. Scheduler tasks added with a specific cpu_affinity are moved to their own cores
+     * instead, so leave those cores out of this list to isolate them. Empty to skip */
+    std::vector<int> non_rt_cpus = {};
+};
+
+/**
+ * @struct SchedulerConfigReport
+ * @brief What ApplySchedulerConfig() has actually applied.
+ */
+struct SchedulerConfigReport
+{
+    /** Whether all memory pages are locked */
+    bool memory_locked = {};
+
+    /** Whether heap trimming is disabled */
+    bool heap_trim_disabled = {};
+
+    /** Size of the calling thread's stack touched in advance [bytes] */
+    size_t stack_prefaulted = {};
+
+    /** Size of heap memory touched in advance [bytes] */
+    size_t heap_prefaulted = {};
+
+    /** Number of existing threads bound to SchedulerConfig::non_rt_cpus */
+    size_t num_threads_bound = {};
+
+    /** Reasons of the settings that failed or are not supported on this platform */
+    std::vector<std::string> errors = {};
+
+    /** String representation of the report */
+    std::string str() const
+    {
+        std::string ret = "memory_locked: " + std::to_string(memory_locked)
+                          + ", heap_trim_disabled: " + std::to_string(heap_trim_disabled)
+                          + ", stack_prefaulted: " + std::to_string(stack_prefaulted)
+                          + ", heap_prefaulted: " + std::to_string(heap_prefaulted)
+                          + ", num_threads_bound: " + std::to_string(num_threads_bound);
+        for (const auto& e : errors) {
+            ret += "\nerror: " + e;
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief [Blocking] Apply the process-wide real-time setup.
+ * @param[in] config Settings to apply.
+ * @return Report of what is applied. Settings that failed do not throw, check
+ * SchedulerConfigReport::errors instead.
+ * @note Call this function in the main thread before instantiating rdk::Robot and rdk::Scheduler,
+ * so that all threads they create inherit the settings.
+ * @note Locking memory requires the CAP_IPC_LOCK capability or a sufficient RLIMIT_MEMLOCK.
+ * @note Only supported on Linux. On other platforms nothing is applied and an error is reported.
+ */
+inline SchedulerConfigReport ApplySchedulerConfig(const SchedulerConfig& config)
+{
+    SchedulerConfigReport report;
+#ifdef __linux__
+    if (config.lock_memory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+            report.memory_locked = true;
+        } else {
+            report.errors.push_back(std::string("mlockall: ") + std::strerror(errno));
+        }
+    }
+
+    if (config.disable_heap_trim) {
+        // Serve all allocations from the heap instead of separate mappings, and never shrink it
+        if (mallopt(M_TRIM_THRESHOLD, -1) == 1 && mallopt(M_MMAP_MAX, 0) == 1) {
+            report.heap_trim_disabled = true;
+        } else {
+            report.errors.push_back("mallopt: Failed to disable heap trimming");
+        }
+    }
+
+    if (config.prefault_stack_size > 0) {
+        auto* stack = static_cast<volatile unsigned char*>(alloca(config.prefault_stack_size));
+        for (size_t i = 0; i < config.prefault_stack_size; i += 4096) {
+            stack[i] = 0;
+        }
+        report.stack_prefaulted = config.prefault_stack_size;
+    }
+
+    if (config.prefault_heap_size > 0) {
+        if (report.heap_trim_disabled) {
+            // Heap trimming is disabled above, so the pages stay in the process after free(). The
+            // writes go through volatile so that they are not removed as dead stores
+            auto* heap = static_cast<volatile unsigned char*>(
+                std::malloc(config.prefault_heap_size));
+            if (heap) {
+                for (size_t i = 0; i < config.prefault_heap_size; i += 4096) {
+                    heap[i] = 0;
+                }
+                std::free(const_cast<unsigned char*>(heap));
+                report.heap_prefaulted = config.prefault_heap_size;
+            } else {
+                report.errors.push_back("malloc: Failed to allocate heap to prefault");
+            }
+        } else {
+            report.errors.push_back("Heap prefault skipped because heap trimming is not disabled");
+        }
+    }
+
+    if (!config.non_rt_cpus.empty()) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (int cpu : config.non_rt_cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpus);
+            } else {
+                report.errors.push_back("Invalid CPU core [" + std::to_string(cpu) + "]");
+            }
+        }
+        // Bind every existing thread of this process, threads created later inherit the affinity
+        // of the creating thread
+        if (DIR* dir = opendir("/proc/self/task")) {
+            while (dirent* entry = readdir(dir)) {
+                if (entry->d_name[0] == '.') {
+                    continue;
+                }
+                const pid_t tid = static_cast<pid_t>(std::atoi(entry->d_name));
+                if (sched_setaffinity(tid, sizeof(cpus), &cpus) == 0) {
+                    report.num_threads_bound++;
+                } else {
+                    report.errors.push_back("sched_setaffinity [" + std::string(entry->d_name)
+                                            + "]: " + std::strerror(errno));
+                }
+            }
+            closedir(dir);
+        } else {
+            report.errors.push_back(
+                std::string("opendir /proc/self/task: ") + std::strerror(errno));
+        }
+    }
+#else
+    (void)config;
+    report.errors.push_back("ApplySchedulerConfig is only supported on Linux");
+#endif
+    return report;
+}
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_SCHEDULER_CONFIG_HPP_ */
@@ -0,0 +1,120 @@
+/**
+ * @file spsc_queue.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_SPSC_QUEUE_HPP_
+#define FLEXIV_RDK_SPSC_QUEUE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class SPSCQueue
+ * @brief Wait-free single-producer single-consumer ring buffer with fixed capacity. Used to pass
+ * data between a real-time task and a non-real-time task (e.g. logging, UI) without a mutex, so the
+ * real-time task can never be blocked by priority inversion. Storage is allocated inline, so no
+ * heap allocation happens after construction.
+ * @tparam T Type of the elements, must be default-constructible and copy-assignable.
+ * @tparam Capacity Maximum number of elements the queue can hold, must be a power of 2.
+ * @warning Only one thread is allowed to push and only one (other) thread is allowed to pop.
+ * @note Due to the inline storage, a queue with large capacity should be allocated statically or on
+ * the heap rather than on the stack.
+ */
+template <typename T, size_t Capacity>
+class SPSCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+        "SPSCQueue capacity must be a power of 2");
+
+public:
+    SPSCQueue() = default;
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * @brief [Non-blocking] Push an element to the back of the queue. Called by the producer.
+     * @param[in] element Element to push.
+     * @return True if pushed, false if the queue is full and the element is dropped.
+     * @note Real-time (RT).
+     */
+    bool Push(const T& element)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == Capacity) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == Capacity) {
+                return false;
+            }
+        }
+        buffer_[tail & kMask] = element;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief [Non-blocking] Pop an element from the front of the queue. Called by the consumer.
+     * @param[out] element Popped element.
+     * @return True if popped, false if the queue is empty.
+     * @note Real-time (RT).
+     */
+    bool Pop(T& element)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) {
+                return false;
+            }
+        }
+        element = buffer_[head & kMask];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief [Non-blocking] Approximate number of elements in the queue. The result is exact when
+     * called by the producer or consumer while the other side is idle.
+     */
+    size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief [Non-blocking] Whether the queue is empty, see size().
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief [Non-blocking] Maximum number of elements the queue can hold.
+     */
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+    static constexpr size_t kCacheLine = 64;
+
+    /** Index of the next element to pop, written by the consumer only */
+    alignas(kCacheLine) std::atomic<size_t> head_ = {0};
+
+    /** Consumer's cached copy of [tail_] */
+    size_t tail_cache_ = 0;
+
+    /** Index of the next element to push, written by the producer only */
+    alignas(kCacheLine) std::atomic<size_t> tail_ = {0};
+
+    /** Producer's cached copy of [head_] */
+    size_t head_cache_ = 0;
+
+    alignas(kCacheLine) std::array<T, Capacity> buffer_ = {};
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_SPSC_QUEUE_HPP_ */
@@ -0,0 +1,163 @@
+/**
+ * @file states_buffer.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_STATES_BUFFER_HPP_
+#define FLEXIV_RDK_STATES_BUFFER_HPP_
+
+#include "robot.hpp"
+#include "trace.hpp"
+#include "utility.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct StatesSnapshot
+ * @brief One consistent snapshot of the robot states, tagged with a sequence number and timestamp.
+ * @see StatesBuffer.
+ */
+struct StatesSnapshot
+{
+    /** Robot states of this snapshot */
+    FixedRobotStates states = {};
+
+    /** Sequence number of this snapshot, starting from 1 and increased by 1 for each write. 0 means
+     * no snapshot is written yet */
+    uint64_t seq = 0;
+
+    /** Time point (steady clock) when this snapshot was written */
+    std::chrono::steady_clock::time_point timestamp = {};
+};
+
+/**
+ * @class StatesBuffer
+ * @brief Seqlock-protected buffer holding the latest robot states snapshot. A single writer (e.g.
+ * the high-priority periodic task) copies the robot states in once per cycle, and any number of
+ * readers in other threads can then get the same consistent snapshot without locking a mutex.
+ * Writing given robot states and reading are heap-allocation-free.
+ * @warning Only one thread is allowed to write to the buffer.
+ * @warning Write(const Robot&) is not real-time safe, as Robot::states() allocates the returned
+ * RobotStates. In real-time code, write the states the periodic task already has instead, i.e.
+ * Write(const RobotStates&) or Write(const FixedRobotStates&).
+ */
+class StatesBuffer
+{
+public:
+    StatesBuffer() = default;
+    StatesBuffer(const StatesBuffer&) = delete;
+    StatesBuffer& operator=(const StatesBuffer&) = delete;
+
+    /**
+     * @brief [Non-blocking] Read the latest robot states from the robot and write them to the
+     * buffer as a new snapshot. Robot::states() is called only once.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot.
+     * @return Sequence number of the written snapshot.
+     * @throw std::invalid_argument if the robot DoF exceeds kMaxJointDoF.
+     * @warning Not real-time safe, as Robot::states() allocates the returned RobotStates. Use
+     * Write(const RobotStates&) in real-time code.
+     */
+    uint64_t Write(const Robot& robot)
+    {
+        FLEXIV_RDK_TRACE_SCOPE("StatesBuffer::Write");
+        return Write(robot.states());
+    }
+
+    /**
+     * @brief [Non-blocking] Write the given robot states to the buffer as a new snapshot.
+     * @param[in] states Robot states to write.
+     * @return Sequence number of the written snapshot.
+     * @throw std::invalid_argument if size of any joint-space vector exceeds kMaxJointDoF.
+     * @note Real-time (RT).
+     */
+    uint64_t Write(const RobotStates& states)
+    {
+        utility::CopyStates(states, scratch_.states);
+        scratch_.timestamp = std::chrono::steady_clock::now();
+        return Publish();
+    }
+
+    /**
+     * @brief [Non-blocking] Write the given fixed-capacity robot states to the buffer as a new
+     * snapshot.
+     * @param[in] states Robot states to write.
+     * @return Sequence number of the written snapshot.
+     * @note Real-time (RT).
+     */
+    uint64_t Write(const FixedRobotStates& states)
+    {
+        scratch_.states = states;
+        scratch_.timestamp = std::chrono::steady_clock::now();
+        return Publish();
+    }
+
+    /**
+     * @brief [Non-blocking] Copy the latest snapshot out of the buffer. All data in the output
+     * belong to the same write, i.e. are never torn between two writes.
+     * @param[out] snapshot Caller-owned snapshot to copy into.
+     * @return True if a snapshot is available, false if nothing is written yet.
+     * @note Lock-free: retries the copy only if a write happened in the meantime.
+     */
+    bool Read(StatesSnapshot& snapshot) const
+    {
+        while (true) {
+            const uint64_t begin = version_.load(std::memory_order_acquire);
+            if (begin == 0) {
+                return false;
+            }
+            // Odd version means a write is in progress
+            if (begin & 1) {
+                continue;
+            }
+            std::memcpy(static_cast<void*>(&snapshot), &data_, sizeof(StatesSnapshot));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (version_.load(std::memory_order_relaxed) == begin) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief [Non-blocking] Sequence number of the latest snapshot written to the buffer.
+     * @return Sequence number, or 0 if nothing is written yet.
+     */
+    uint64_t seq() const { return version_.load(std::memory_order_acquire) / 2; }
+
+private:
+    static_assert(std::is_trivially_copyable<StatesSnapshot>::value,
+        "StatesSnapshot must be trivially copyable to be protected by a seqlock");
+
+    uint64_t Publish()
+    {
+        const uint64_t version = version_.load(std::memory_order_relaxed);
+        scratch_.seq = version / 2 + 1;
+
+        // Mark write in progress, then copy the prepared snapshot in one go
+        version_.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(static_cast<void*>(&data_), &scratch_, sizeof(StatesSnapshot));
+        version_.store(version + 2, std::memory_order_release);
+
+        return scratch_.seq;
+    }
+
+    /** Seqlock version counter: odd while writing, twice the sequence number when idle */
+    std::atomic<uint64_t> version_ = {0};
+
+    /** Published snapshot */
+    StatesSnapshot data_ = {};
+
+    /** Writer-side scratch to prepare the next snapshot outside the critical section */
+    StatesSnapshot scratch_ = {};
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_STATES_BUFFER_HPP_ */
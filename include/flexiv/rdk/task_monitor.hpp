@@ -0,0 +1,277 @@
+/**
+ * @file task_monitor.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_TASK_MONITOR_HPP_
+#define FLEXIV_RDK_TASK_MONITOR_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct TimingSummary
+ * @brief Percentiles and maximum of a recorded timing quantity. Unit: \f$ [\mu s] \f$.
+ * @note Except for [max], values are upper bounds of histogram buckets with ~3% relative
+ * resolution above 64 us and 1 us resolution below.
+ */
+struct TimingSummary
+{
+    /** Median */
+    double p50 = {};
+
+    /** 99th percentile */
+    double p99 = {};
+
+    /** 99.9th percentile */
+    double p999 = {};
+
+    /** Maximum recorded value, exact */
+    double max = {};
+};
+
+/**
+ * @struct TaskTimingStats
+ * @brief Timing statistics of a periodic task.
+ * @see TaskMonitor::stats().
+ */
+struct TaskTimingStats
+{
+    /** Number of recorded executions */
+    uint64_t count = {};
+
+    /** Number of executions whose execution time exceeded the task interval */
+    uint64_t overruns = {};
+
+    /** Wake-up jitter, i.e. absolute deviation of the measured interval between two consecutive
+     * executions from the nominal task interval */
+    TimingSummary jitter = {};
+
+    /** Execution time of the task callback */
+    TimingSummary exec_time = {};
+};
+
+/**
+ * @class TimingHistogram
+ * @brief Lock-free log-linear histogram of timing values in microseconds. Recording is wait-free
+ * and heap-allocation-free, and can be done from a real-time thread while other threads read.
+ * @warning Only one thread is allowed to call Record().
+ */
+class TimingHistogram
+{
+public:
+    /**
+     * @brief [Non-blocking] Record one value.
+     * @param[in] value_us Value to record. Unit: \f$ [\mu s] \f$.
+     * @note Real-time (RT).
+     */
+    void Record(uint64_t value_us)
+    {
+        buckets_[BucketIndex(value_us)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        if (value_us > max_.load(std::memory_order_relaxed)) {
+            max_.store(value_us, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief [Non-blocking] Number of recorded values.
+     */
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Summary of the recorded values.
+     * @return TimingSummary value copy. All fields are 0 if nothing is recorded yet.
+     */
+    TimingSummary summary() const
+    {
+        // Take a local copy so that all percentiles are computed from the same bucket counts
+        std::array<uint64_t, kNumBuckets> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < kNumBuckets; i++) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        TimingSummary ret;
+        if (total == 0) {
+            return ret;
+        }
+        ret.max = static_cast<double>(max_.load(std::memory_order_relaxed));
+        ret.p50 = std::min(Percentile(counts, total, 0.5), ret.max);
+        ret.p99 = std::min(Percentile(counts, total, 0.99), ret.max);
+        ret.p999 = std::min(Percentile(counts, total, 0.999), ret.max);
+        return ret;
+    }
+
+private:
+    /** Values below 2 x kSubBuckets are stored with 1 us resolution */
+    static constexpr size_t kSubBucketBits = 5;
+    static constexpr size_t kSubBuckets = 1 << kSubBucketBits;
+
+    /** Largest recordable power of 2 [us], larger values are clamped into the last bucket */
+    static constexpr size_t kMaxExponent = 40;
+
+    static constexpr size_t kNumBuckets
+        = 2 * kSubBuckets + (kMaxExponent - kSubBucketBits) * kSubBuckets;
+
+    static size_t BucketIndex(uint64_t value)
+    {
+        if (value < 2 * kSubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        size_t msb = 0;
+        while ((value >> (msb + 1)) != 0) {
+            msb++;
+        }
+        if (msb > kMaxExponent) {
+            return kNumBuckets - 1;
+        }
+        const size_t shift = msb - kSubBucketBits;
+        const size_t top = static_cast<size_t>(value >> shift);
+        return 2 * kSubBuckets + (shift - 1) * kSubBuckets + (top - kSubBuckets);
+    }
+
+    static double BucketUpperBound(size_t index)
+    {
+        if (index < 2 * kSubBuckets) {
+            return static_cast<double>(index);
+        }
+        const size_t shift = (index - 2 * kSubBuckets) / kSubBuckets + 1;
+        const size_t top = (index - 2 * kSubBuckets) % kSubBuckets + kSubBuckets;
+        return static_cast<double>((static_cast<uint64_t>(top + 1) << shift) - 1);
+    }
+
+    static double Percentile(
+        const std::array<uint64_t, kNumBuckets>& counts, uint64_t total, double fraction)
+    {
+        const double rank = fraction * static_cast<double>(total);
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < kNumBuckets; i++) {
+            accumulated += counts[i];
+            if (static_cast<double>(accumulated) >= rank) {
+                return BucketUpperBound(i);
+            }
+        }
+        return BucketUpperBound(kNumBuckets - 1);
+    }
+
+    std::array<std::atomic<uint64_t>, kNumBuckets> buckets_ = {};
+    std::atomic<uint64_t> count_ = {0};
+    std::atomic<uint64_t> max_ = {0};
+};
+
+/**
+ * @class TaskMonitor
+ * @brief Records per-task timing statistics of tasks running in rdk::Scheduler: wake-up jitter,
+ * execution time, and number of overruns. The user task callback is wrapped before being added to
+ * the scheduler, then the statistics can be read from any thread while the tasks are running.
+ */
+class TaskMonitor
+{
+public:
+    TaskMonitor() = default;
+    TaskMonitor(const TaskMonitor&) = delete;
+    TaskMonitor& operator=(const TaskMonitor&) = delete;
+
+    /**
+     * @brief [Non-blocking] Wrap a task callback so that its timing is recorded on every
+     * execution. Pass the returned callback to Scheduler::AddTask().
+     * @param[in] callback Callback function of user task.
+     * @param[in] task_name A unique name for this task, used to query its statistics.
+     * @param[in] interval Execution interval of this periodic task [ms], same as the one passed to
+     * Scheduler::AddTask().
+     * @return Wrapped callback function.
+     * @throw std::invalid_argument if [interval] is not positive or [task_name] is duplicate.
+     * @note The returned callback refers to this instance, so this instance must outlive the
+     * scheduler that runs the callback.
+     * @warning Calling this function after Scheduler::Start() is not allowed.
+     * @warning The first execution after Scheduler::Start() has no previous execution to compare
+     * to and is not recorded as jitter. The pause between Scheduler::Stop() and a restart is
+     * however recorded as one large jitter value.
+     */
+    std::function<void(void)> Wrap(
+        std::function<void(void)>&& callback, const std::string& task_name, int interval)
+    {
+        if (interval <= 0) {
+            throw std::invalid_argument("TaskMonitor::Wrap: Interval must be positive");
+        }
+        if (records_.count(task_name)) {
+            throw std::invalid_argument(
+                "TaskMonitor::Wrap: Task name [" + task_name + "] is duplicate");
+        }
+        auto& record = records_[task_name];
+        record = std::make_unique<Record>();
+        record->interval_us = static_cast<int64_t>(interval) * 1000;
+
+        Record* r = record.get();
+        return [r, cb = std::move(callback)]() {
+            auto tic = std::chrono::steady_clock::now();
+            if (r->has_last_wake) {
+                auto period = tic - r->last_wake;
+                const int64_t period_us
+                    = std::chrono::duration_cast<std::chrono::microseconds>(period).count();
+                const int64_t deviation = period_us - r->interval_us;
+                r->jitter.Record(static_cast<uint64_t>(deviation < 0 ? -deviation : deviation));
+            }
+            r->last_wake = tic;
+            r->has_last_wake = true;
+
+            cb();
+
+            auto toc = std::chrono::steady_clock::now();
+            const int64_t exec_us
+                = std::chrono::duration_cast<std::chrono::microseconds>(toc - tic).count();
+            r->exec_time.Record(static_cast<uint64_t>(exec_us));
+            if (exec_us > r->interval_us) {
+                r->overruns.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+    }
+
+    /**
+     * @brief [Non-blocking] Timing statistics of the specified task.
+     * @param[in] task_name Name of the task given to Wrap().
+     * @return TaskTimingStats value copy.
+     * @throw std::out_of_range if the specified task does not exist.
+     */
+    TaskTimingStats stats(const std::string& task_name) const
+    {
+        const auto& r = records_.at(task_name);
+        TaskTimingStats ret;
+        ret.count = r->exec_time.count();
+        ret.overruns = r->overruns.load(std::memory_order_relaxed);
+        ret.jitter = r->jitter.summary();
+        ret.exec_time = r->exec_time.summary();
+        return ret;
+    }
+
+private:
+    struct Record
+    {
+        int64_t interval_us = 0;
+        bool has_last_wake = false;
+        std::chrono::steady_clock::time_point last_wake = {};
+        std::atomic<uint64_t> overruns = {0};
+        TimingHistogram jitter;
+        TimingHistogram exec_time;
+    };
+
+    std::map<std::string, std::unique_ptr<Record>> records_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_TASK_MONITOR_HPP_ */
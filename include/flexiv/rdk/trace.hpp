@@ -0,0 +1,243 @@
+/**
+ * @file trace.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_TRACE_HPP_
+#define FLEXIV_RDK_TRACE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @class Tracer
+ * @brief Process-wide recorder of timed trace events, exported in the Chrome trace event format
+ * that can be opened in Perfetto (https://ui.perfetto.dev) or chrome://tracing. Events are
+ * recorded into a preallocated buffer with a wait-free atomic index, so recording is safe from
+ * real-time threads. While tracing is stopped, recording an event costs one relaxed atomic load.
+ * @note Use the FLEXIV_RDK_TRACE_SCOPE() macro to add trace points, which compile to nothing unless
+ * FLEXIV_RDK_ENABLE_TRACING is defined.
+ * @warning An event is dropped once the buffer is full.
+ */
+class Tracer
+{
+public:
+    /**
+     * @brief [Non-blocking] The process-wide tracer instance.
+     */
+    static Tracer& instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    /**
+     * @brief [Non-blocking] Clear previously recorded events and start recording.
+     * @param[in] capacity Maximum number of events to record.
+     * @throw std::logic_error if already started.
+     * @throw std::invalid_argument if [capacity] is 0.
+     * @warning If [capacity] differs from the previous call, the buffer is reallocated, so no other
+     * thread may be inside a trace point at the time of the call.
+     */
+    void Start(size_t capacity = 1 << 20)
+    {
+        if (enabled_.load(std::memory_order_relaxed)) {
+            throw std::logic_error("Tracer::Start: Already started");
+        }
+        if (capacity == 0) {
+            throw std::invalid_argument("Tracer::Start: [capacity] cannot be 0");
+        }
+        if (capacity != capacity_) {
+            events_.reset(new Event[capacity]);
+            capacity_ = capacity;
+        } else {
+            for (size_t i = 0; i < capacity_; i++) {
+                events_[i].ready.store(false, std::memory_order_relaxed);
+            }
+        }
+        next_.store(0, std::memory_order_relaxed);
+        origin_ = std::chrono::steady_clock::now();
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief [Non-blocking] Stop recording. Recorded events are kept until the next Start().
+     */
+    void Stop() { enabled_.store(false, std::memory_order_release); }
+
+    /**
+     * @brief [Non-blocking] Whether recording is started.
+     * @note Real-time (RT).
+     */
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Record one complete event.
+     * @param[in] name Name of the event. Must be a string literal or otherwise outlive the tracer.
+     * @param[in] begin Begin time of the event.
+     * @param[in] end End time of the event.
+     * @note Real-time (RT).
+     */
+    void Record(const char* name, std::chrono::steady_clock::time_point begin,
+        std::chrono::steady_clock::time_point end)
+    {
+        if (!enabled_.load(std::memory_order_acquire)) {
+            return;
+        }
+        const size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= capacity_) {
+            return;
+        }
+        auto& event = events_[index];
+        event.name = name;
+        event.begin_ns = ToNs(begin);
+        event.end_ns = ToNs(end);
+        event.thread_id = ThreadId();
+        event.ready.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief [Non-blocking] Number of events recorded since the last Start(), including dropped
+     * ones.
+     */
+    size_t num_events() const { return next_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Blocking] Export recorded events to a JSON file in the Chrome trace event format.
+     * @param[in] file_path Path of the JSON file to write.
+     * @throw std::runtime_error if failed to write the file.
+     * @note Events still being recorded by other threads at the time of export are skipped.
+     */
+    void Export(const std::string& file_path) const
+    {
+        std::ofstream file(file_path);
+        if (!file.is_open()) {
+            throw std::runtime_error("Tracer::Export: Failed to open [" + file_path + "]");
+        }
+        file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        const size_t num = std::min(next_.load(std::memory_order_relaxed), capacity_);
+        bool first = true;
+        for (size_t i = 0; i < num; i++) {
+            const auto& event = events_[i];
+            if (!event.ready.load(std::memory_order_acquire)) {
+                continue;
+            }
+            file << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name
+                 << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id
+                 << ",\"ts\":" << event.begin_ns / 1000 << "." << Pad3(event.begin_ns % 1000)
+                 << ",\"dur\":" << (event.end_ns - event.begin_ns) / 1000 << "."
+                 << Pad3((event.end_ns - event.begin_ns) % 1000) << "}";
+            first = false;
+        }
+        file << "\n]}\n";
+        if (!file.good()) {
+            throw std::runtime_error("Tracer::Export: Failed to write [" + file_path + "]");
+        }
+    }
+
+private:
+    Tracer() = default;
+
+    struct Event
+    {
+        const char* name = nullptr;
+        uint64_t begin_ns = 0;
+        uint64_t end_ns = 0;
+        uint32_t thread_id = 0;
+        std::atomic<bool> ready = {false};
+    };
+
+    uint64_t ToNs(std::chrono::steady_clock::time_point t) const
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t - origin_).count();
+        return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+    }
+
+    static uint32_t ThreadId()
+    {
+        static std::atomic<uint32_t> counter = {0};
+        thread_local const uint32_t id = counter.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    static std::string Pad3(uint64_t value)
+    {
+        std::string str = std::to_string(value);
+        return std::string(3 - str.size(), '0') + str;
+    }
+
+    std::unique_ptr<Event[]> events_;
+    size_t capacity_ = 0;
+    std::atomic<size_t> next_ = {0};
+    std::atomic<bool> enabled_ = {false};
+    std::chrono::steady_clock::time_point origin_ = {};
+};
+
+/**
+ * @class TraceScope
+ * @brief Records a trace event spanning the lifetime of this instance, see Tracer.
+ */
+class TraceScope
+{
+public:
+    /**
+     * @brief [Non-blocking] Begin the trace event.
+     * @param[in] name Name of the event. Must be a string literal.
+     * @note Real-time (RT).
+     */
+    explicit TraceScope(const char* name)
+    : name_(name)
+    , begin_(Tracer::instance().enabled() ? std::chrono::steady_clock::now()
+                                          : std::chrono::steady_clock::time_point())
+    {
+    }
+
+    /**
+     * @brief [Non-blocking] End and record the trace event.
+     * @note Real-time (RT).
+     */
+    ~TraceScope()
+    {
+        if (begin_ != std::chrono::steady_clock::time_point()) {
+            Tracer::instance().Record(name_, begin_, std::chrono::steady_clock::now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    const std::chrono::steady_clock::time_point begin_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#define FLEXIV_RDK_TRACE_CONCAT_IMPL(a, b) a##b
+#define FLEXIV_RDK_TRACE_CONCAT(a, b) FLEXIV_RDK_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Trace the enclosing scope as one event with the given name, which must be a string
+ * literal. Compiles to nothing unless FLEXIV_RDK_ENABLE_TRACING is defined.
+ */
+#ifdef FLEXIV_RDK_ENABLE_TRACING
+#define FLEXIV_RDK_TRACE_SCOPE(name)                                                               \
+    flexiv::rdk::TraceScope FLEXIV_RDK_TRACE_CONCAT(flexiv_rdk_trace_scope_, __LINE__)(name)
+#else
+#define FLEXIV_RDK_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif /* FLEXIV_RDK_TRACE_HPP_ */
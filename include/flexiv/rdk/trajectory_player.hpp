@@ -0,0 +1,324 @@
+/**
+ * @file trajectory_player.hpp
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ */
+
+#ifndef FLEXIV_RDK_TRAJECTORY_PLAYER_HPP_
+#define FLEXIV_RDK_TRAJECTORY_PLAYER_HPP_
+
+#include "command_buffer.hpp"
+#include "player_core.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace flexiv {
+namespace rdk {
+
+/**
+ * @struct JointWaypoint
+ * @brief Time-stamped waypoint of a joint trajectory played by JointTrajectoryPlayer.
+ */
+struct JointWaypoint
+{
+    /** Time of this waypoint since the start of the trajectory. Unit: \f$ [s] \f$ */
+    double time = {};
+
+    /** Joint positions. Only the first DoF elements are used. Unit: \f$ [rad] \f$ */
+    std::array<double, kMaxJointDoF> positions = {};
+
+    /** Joint velocities. Only the first DoF elements are used. Unit: \f$ [rad/s] \f$ */
+    std::array<double, kMaxJointDoF> velocities = {};
+};
+
+/**
+ * @class JointTrajectoryPlayer
+ * @brief Plays time-stamped joint waypoints submitted from non-real-time code by streaming joint
+ * position commands from an internal 1 kHz real-time task. Waypoints are buffered ahead in a
+ * wait-free queue and interpolated between with cubic Hermite splines, so hiccups of the
+ * submitting thread do not show up as motion jitter as long as the buffer does not run empty.
+ * @note Before a trajectory starts and after it ends, the robot holds the last commanded
+ * positions.
+ * @note While the buffer is empty before the trajectory ends, which is counted as an underrun, the
+ * trajectory time pauses and the commanded positions settle on the last played waypoint like a
+ * critically damped spring with time constant kUnderrunTimeConstant. The robot thus decelerates
+ * smoothly and overshoots that waypoint by about (velocity × kUnderrunTimeConstant / e) at most,
+ * instead of stopping at once. Once waypoints arrive again, playback resumes from the last played
+ * waypoint, so the commanded positions step back by the remaining overshoot and the velocities
+ * step from the settling ones to the spline's.
+ */
+class JointTrajectoryPlayer
+{
+public:
+    /** Maximum number of waypoints that can be buffered ahead */
+    static constexpr size_t kBufferSize = 4096;
+
+    /** Time constant of the settling on the last played waypoint during underruns. Unit: \f$ [s]
+     * \f$ */
+    static constexpr double kUnderrunTimeConstant = 0.05;
+
+    /**
+     * @brief [Blocking] Instantiate the player and its internal real-time scheduler.
+     * @param[in] robot Reference to the instance of flexiv::rdk::Robot to stream commands to.
+     * @param[in] cpu_affinity CPU core for the internal real-time task thread to bind to, see
+     * Scheduler::AddTask().
+     * @throw std::runtime_error if the scheduler initialization sequence failed.
+     * @throw std::invalid_argument if [cpu_affinity] is invalid.
+     * @note The internal task runs at the scheduler's maximum priority.
+     * @note The instance of flexiv::rdk::Robot must outlive this instance.
+     */
+    JointTrajectoryPlayer(Robot& robot, int cpu_affinity = -1)
+    : robot_(robot)
+    , command_(robot)
+    , core_(robot, "JointTrajectoryPlayer", [this]() { Step(); }, cpu_affinity)
+    {
+    }
+
+    /**
+     * @brief [Blocking] Stop the playback if it is running.
+     */
+    virtual ~JointTrajectoryPlayer() = default;
+
+    JointTrajectoryPlayer(const JointTrajectoryPlayer&) = delete;
+    JointTrajectoryPlayer& operator=(const JointTrajectoryPlayer&) = delete;
+
+    /**
+     * @brief [Blocking] Start the internal real-time task, which holds the current joint positions
+     * until the first waypoint is submitted. Waypoints left over from a previous run are discarded.
+     * @throw std::logic_error if already started or robot is not in the correct control mode.
+     * @throw std::runtime_error if failed to start the internal real-time task.
+     * @note Applicable control modes: RT_JOINT_IMPEDANCE, RT_JOINT_POSITION.
+     * @note This function blocks until the internal real-time task is started.
+     */
+    void Start()
+    {
+        core_.Start([this]() {
+            if (robot_.mode() != Mode::RT_JOINT_IMPEDANCE
+                && robot_.mode() != Mode::RT_JOINT_POSITION) {
+                throw std::logic_error(
+                    "JointTrajectoryPlayer::Start: Robot is not in the correct control mode");
+            }
+            const auto states = robot_.states();
+            std::copy(states.q.begin(), states.q.end(), command_.positions().begin());
+            std::fill(command_.velocities().begin(), command_.velocities().end(), 0.0);
+            std::fill(command_.accelerations().begin(), command_.accelerations().end(), 0.0);
+            has_prev_ = false;
+            has_next_ = false;
+        });
+    }
+
+    /**
+     * @brief [Blocking] Stop the internal real-time task and the playback.
+     * @throw std::logic_error if not started yet.
+     * @throw std::runtime_error if failed to stop the internal real-time task.
+     * @warning The robot stops receiving commands once stopped, switch the robot to another mode
+     * afterwards.
+     */
+    void Stop() { core_.Stop(); }
+
+    /**
+     * @brief [Non-blocking] Submit a batch of waypoints to be buffered and played after all
+     * previously submitted ones. Called from one non-real-time thread.
+     * @param[in] waypoints Waypoints with strictly increasing [time]. The first waypoint of a
+     * trajectory is reached immediately if the one after it is already buffered, so it should be
+     * close to the commanded positions when it starts playing. Otherwise it is settled on as in
+     * an underrun.
+     * @param[in] end_of_trajectory Whether the last waypoint of this batch ends the trajectory. The
+     * next submitted waypoint then starts a new trajectory whose time begins again.
+     * @return Number of waypoints accepted from the front of the batch, less than the batch size if
+     * the buffer is full. Submit the rest again later.
+     * @throw std::invalid_argument if [time] is not strictly increasing within the trajectory.
+     * @note When not all waypoints are accepted, [end_of_trajectory] is ignored for this call.
+     */
+    size_t Submit(const std::vector<JointWaypoint>& waypoints, bool end_of_trajectory = false)
+    {
+        // A new run starts a new trajectory
+        if (core_.TakeReset()) {
+            has_last_submitted_ = false;
+        }
+        double last_time = last_submitted_time_;
+        bool has_last = has_last_submitted_;
+        for (const auto& wp : waypoints) {
+            if (has_last && wp.time <= last_time) {
+                throw std::invalid_argument(
+                    "JointTrajectoryPlayer::Submit: Waypoint time is not strictly increasing");
+            }
+            last_time = wp.time;
+            has_last = true;
+        }
+
+        size_t num_accepted = 0;
+        for (size_t i = 0; i < waypoints.size(); i++) {
+            Item item;
+            item.waypoint = waypoints[i];
+            item.last = end_of_trajectory && i + 1 == waypoints.size();
+            if (!core_.Push(item)) {
+                break;
+            }
+            last_submitted_time_ = item.waypoint.time;
+            has_last_submitted_ = !item.last;
+            num_accepted++;
+        }
+        return num_accepted;
+    }
+
+    /**
+     * @brief [Non-blocking] Number of waypoints buffered and not played yet.
+     */
+    size_t num_buffered() const { return core_.num_buffered(); }
+
+    /**
+     * @brief [Non-blocking] Number of real-time cycles in which a trajectory was not ended yet but
+     * the buffer ran empty, so the trajectory time paused and the commanded positions settled on
+     * the last played waypoint.
+     */
+    uint64_t num_underruns() const { return core_.num_underruns(); }
+
+    /**
+     * @brief [Non-blocking] Number of trajectories fully played, see Submit().
+     */
+    uint64_t num_finished() const { return num_finished_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief [Non-blocking] Whether the internal real-time task has stopped streaming due to an
+     * error, e.g. robot fault or command rejected. See error_message() for details. Cleared by
+     * Start().
+     */
+    bool fault() const { return core_.fault(); }
+
+    /**
+     * @brief [Non-blocking] Message of the error that stopped streaming, empty if fault() is false.
+     */
+    std::string error_message() const { return core_.error_message(); }
+
+private:
+    struct Item
+    {
+        JointWaypoint waypoint;
+        bool last = false;
+    };
+
+    static constexpr double kPeriod = PlayerCore<Item, kBufferSize>::kPeriod;
+
+    void Step()
+    {
+        FLEXIV_RDK_TRACE_SCOPE("JointTrajectoryPlayer::Step");
+        Interpolate();
+        FLEXIV_RDK_TRACE_SCOPE("Robot::StreamJointPosition");
+        command_.Commit();
+    }
+
+    void Interpolate()
+    {
+        // Start a new trajectory from its first waypoint
+        if (!has_prev_) {
+            if (!core_.Pop(prev_)) {
+                return;
+            }
+            time_ = prev_.waypoint.time;
+            has_prev_ = true;
+        } else {
+            time_ += kPeriod;
+        }
+
+        // Advance to the segment that contains the current time
+        while (!prev_.last) {
+            if (!has_next_) {
+                if (!core_.Pop(next_)) {
+                    break;
+                }
+                has_next_ = true;
+            }
+            if (next_.waypoint.time > time_) {
+                break;
+            }
+            prev_ = next_;
+            has_next_ = false;
+        }
+
+        const size_t dof = command_.positions().size();
+        auto& pos = command_.positions();
+        auto& vel = command_.velocities();
+        auto& acc = command_.accelerations();
+
+        // Hold the last waypoint if the trajectory ended, settle on it if the buffer ran empty
+        if (!has_next_) {
+            const auto& p = prev_.waypoint.positions;
+            if (prev_.last) {
+                std::copy(p.begin(), p.begin() + dof, pos.begin());
+                std::fill(vel.begin(), vel.end(), 0.0);
+                std::fill(acc.begin(), acc.end(), 0.0);
+                has_prev_ = false;
+                num_finished_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                Settle(p);
+                time_ = prev_.waypoint.time;
+                core_.CountUnderrun();
+            }
+            return;
+        }
+
+        // Cubic Hermite spline between the two waypoints of the current segment
+        const auto& w0 = prev_.waypoint;
+        const auto& w1 = next_.waypoint;
+        const double h = w1.time - w0.time;
+        const double s = (time_ - w0.time) / h;
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+        for (size_t i = 0; i < dof; i++) {
+            const double p0 = w0.positions[i];
+            const double p1 = w1.positions[i];
+            const double m0 = h * w0.velocities[i];
+            const double m1 = h * w1.velocities[i];
+            pos[i] = (2 * s3 - 3 * s2 + 1) * p0 + (s3 - 2 * s2 + s) * m0 + (-2 * s3 + 3 * s2) * p1
+                     + (s3 - s2) * m1;
+            vel[i] = ((6 * s2 - 6 * s) * p0 + (3 * s2 - 4 * s + 1) * m0 + (-6 * s2 + 6 * s) * p1
+                         + (3 * s2 - 2 * s) * m1)
+                     / h;
+            acc[i] = ((12 * s - 6) * p0 + (6 * s - 4) * m0 + (-12 * s + 6) * p1 + (6 * s - 2) * m1)
+                     / (h * h);
+        }
+    }
+
+    /** Move the commanded positions towards the hold positions like a critically damped spring */
+    void Settle(const std::array<double, kMaxJointDoF>& hold)
+    {
+        constexpr double w = 1.0 / kUnderrunTimeConstant;
+        auto& pos = command_.positions();
+        auto& vel = command_.velocities();
+        auto& acc = command_.accelerations();
+        for (size_t i = 0; i < pos.size(); i++) {
+            acc[i] = w * w * (hold[i] - pos[i]) - 2 * w * vel[i];
+            vel[i] += acc[i] * kPeriod;
+            pos[i] += vel[i] * kPeriod;
+        }
+    }
+
+    Robot& robot_;
+    JointPositionCommand command_;
+
+    /** Written by the submitting thread only */
+    double last_submitted_time_ = 0.0;
+    bool has_last_submitted_ = false;
+
+    /** Accessed by the real-time task only, except when the task is not running */
+    Item prev_;
+    Item next_;
+    bool has_prev_ = false;
+    bool has_next_ = false;
+    double time_ = 0.0;
+
+    std::atomic<uint64_t> num_finished_ = {0};
+
+    /** Last member, so that the real-time task stops before the others are destroyed */
+    PlayerCore<Item, kBufferSize> core_;
+};
+
+} /* namespace rdk */
+} /* namespace flexiv */
+
+#endif /* FLEXIV_RDK_TRAJECTORY_PLAYER_HPP_ */
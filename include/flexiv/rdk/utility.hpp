@@ -8,7 +8,15 @@
 
 #include "data.hpp"
 #include <Eigen/Eigen>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
 #include <sstream>
+#include <stdexcept>
+#include <type_traits>
 
 namespace flexiv {
 namespace rdk {
@@ -23,14 +31,56 @@ namespace utility {
  */
 inline std::array<double, 3> Quat2EulerZYX(const std::array<double, 4>& quat)
 {
-    // Form quaternion
-    Eigen::Quaterniond q(quat[0], quat[1], quat[2], quat[3]);
+    const double w = quat[0], x = quat[1], y = quat[2], z = quat[3];
 
-    // The returned array is in [z,y,x] order
-    auto euler_ZYX = q.toRotationMatrix().eulerAngles(2, 1, 0);
+    // Only the rotation matrix elements needed by the ZYX decomposition
+    const double m00 = 1.0 - 2.0 * (y * y + z * z);
+    const double m01 = 2.0 * (x * y - w * z);
+    const double m02 = 2.0 * (x * z + w * y);
+    const double m10 = 2.0 * (x * y + w * z);
+    const double m11 = 1.0 - 2.0 * (x * x + z * z);
+    const double m12 = 2.0 * (y * z - w * x);
+    const double m20 = 2.0 * (x * z - w * y);
+    const double m21 = 2.0 * (y * z + w * x);
+    const double m22 = 1.0 - 2.0 * (x * x + y * y);
 
-    // Convert to general [x,y,z] order
-    return (std::array<double, 3> {euler_ZYX[2], euler_ZYX[1], euler_ZYX[0]});
+    // Same decomposition and angle ranges as Eigen::MatrixBase::eulerAngles(2, 1, 0), i.e. the
+    // angle about z is within [0, pi]
+    constexpr double kPi = 3.14159265358979323846;
+    double rz = std::atan2(m10, m00);
+    const double c2 = std::hypot(m22, m21);
+    double ry = 0.0;
+
+    // Sine and cosine of the angle about z, taken from the matrix instead of computed again
+    const double r = std::hypot(m10, m00);
+    double s1 = r > 0.0 ? m10 / r : 0.0;
+    double c1 = r > 0.0 ? m00 / r : 1.0;
+    if (rz < 0.0) {
+        rz += kPi;
+        ry = std::atan2(-m20, -c2);
+        s1 = -s1;
+        c1 = -c1;
+    } else {
+        ry = std::atan2(-m20, c2);
+    }
+    const double rx = std::atan2(s1 * m02 - c1 * m12, c1 * m11 - s1 * m01);
+
+    return (std::array<double, 3> {rx, ry, rz});
+}
+
+/**
+ * @brief Convert a batch of quaternions to Euler angles with ZYX axis rotations, see
+ * Quat2EulerZYX().
+ * @param[in] quats Pointer to [num] quaternions in [w,x,y,z] order.
+ * @param[out] eulers Pointer to [num] Euler angles to write in [x,y,z] order [rad].
+ * @param[in] num Number of quaternions to convert.
+ */
+inline void Quat2EulerZYX(
+    const std::array<double, 4>* quats, std::array<double, 3>* eulers, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        eulers[i] = Quat2EulerZYX(quats[i]);
+    }
 }
 
 /**
@@ -60,13 +110,74 @@ inline std::array<double, N> Rad2Deg(const std::array<double, N>& rad_arr)
  */
 inline std::vector<double> Rad2Deg(const std::vector<double>& rad_vec)
 {
-    std::vector<double> deg_vec;
-    for (const auto& v : rad_vec) {
-        deg_vec.push_back(Rad2Deg(v));
+    std::vector<double> deg_vec(rad_vec.size());
+    for (size_t i = 0; i < rad_vec.size(); i++) {
+        deg_vec[i] = Rad2Deg(rad_vec[i]);
     }
     return deg_vec;
 }
 
+/**
+ * @brief Convert radians to degrees for a batch of values without any heap allocation.
+ * @param[in] rad Pointer to [num] values to convert [rad].
+ * @param[out] deg Pointer to [num] values to write [deg]. Can be the same as [rad] to convert in
+ * place.
+ * @param[in] num Number of values to convert.
+ * @note Real-time (RT).
+ */
+inline void Rad2Deg(const double* rad, double* deg, size_t num)
+{
+    constexpr double kRad2Deg = 180.0 / 3.14159265358979323846;
+    for (size_t i = 0; i < num; i++) {
+        deg[i] = rad[i] * kRad2Deg;
+    }
+}
+
+/**
+ * @brief Copy robot states into a caller-owned fixed-capacity buffer without any heap allocation.
+ * @param[in] states Robot states to copy from, e.g. the return value of Robot::states().
+ * @param[out] fixed_states Fixed-capacity robot states to copy into. Joint-space elements beyond
+ * the actual DoF are set to 0.
+ * @throw std::invalid_argument if size of any joint-space vector in [states] exceeds kMaxJointDoF.
+ * @note Call Robot::states() only once per control cycle and copy it with this function, then
+ * pass the fixed-capacity copy around instead of calling Robot::states() again.
+ */
+inline void CopyStates(const RobotStates& states, FixedRobotStates& fixed_states)
+{
+    const size_t dof = states.q.size();
+    if (dof > kMaxJointDoF || states.theta.size() > kMaxJointDoF
+        || states.dq.size() > kMaxJointDoF || states.dtheta.size() > kMaxJointDoF
+        || states.tau.size() > kMaxJointDoF || states.tau_des.size() > kMaxJointDoF
+        || states.tau_dot.size() > kMaxJointDoF || states.tau_ext.size() > kMaxJointDoF) {
+        throw std::invalid_argument(
+            "CopyStates: Size of joint-space states exceeds the maximum capacity kMaxJointDoF");
+    }
+
+    // Copy the valid elements and zero the rest
+    auto copy = [](const std::vector<double>& src, std::array<double, kMaxJointDoF>& dst) {
+        std::copy(src.begin(), src.end(), dst.begin());
+        std::fill(dst.begin() + src.size(), dst.end(), 0.0);
+    };
+
+    fixed_states.DoF = dof;
+    copy(states.q, fixed_states.q);
+    copy(states.theta, fixed_states.theta);
+    copy(states.dq, fixed_states.dq);
+    copy(states.dtheta, fixed_states.dtheta);
+    copy(states.tau, fixed_states.tau);
+    copy(states.tau_des, fixed_states.tau_des);
+    copy(states.tau_dot, fixed_states.tau_dot);
+    copy(states.tau_ext, fixed_states.tau_ext);
+    fixed_states.tcp_pose = states.tcp_pose;
+    fixed_states.tcp_vel = states.tcp_vel;
+    fixed_states.flange_pose = states.flange_pose;
+    fixed_states.ft_sensor_raw = states.ft_sensor_raw;
+    fixed_states.ext_wrench_in_tcp = states.ext_wrench_in_tcp;
+    fixed_states.ext_wrench_in_world = states.ext_wrench_in_world;
+    fixed_states.ext_wrench_in_tcp_raw = states.ext_wrench_in_tcp_raw;
+    fixed_states.ext_wrench_in_world_raw = states.ext_wrench_in_world_raw;
+}
+
 /**
  * @brief Convert an std::vector to a string.
  * @param[in] vec std::vector of any type and size.
@@ -101,9 +212,95 @@ template <typename T, size_t N>
 inline std::string Arr2Str(
     const std::array<T, N>& arr, size_t decimal = 3, const std::string& separator = " ")
 {
-    std::vector<T> vec(N);
-    std::copy(arr.begin(), arr.end(), vec.begin());
-    return Vec2Str(vec, decimal, separator);
+    std::string padding = "";
+    std::ostringstream oss;
+    oss.precision(decimal);
+    oss << std::fixed;
+
+    for (const auto& v : arr) {
+        oss << padding << v;
+        padding = separator;
+    }
+    return oss.str();
+}
+
+/**
+ * @brief Format numbers with fixed decimal places into a caller-owned buffer without any heap
+ * allocation, e.g. for logging from real-time threads or writing telemetry at high rates.
+ * @param[in] nums Pointer to [num] integral or floating-point numbers.
+ * @param[in] num Number of numbers to format.
+ * @param[out] buffer Buffer to write the null-terminated string to.
+ * @param[in] buffer_size Size of [buffer] in bytes. The output is truncated to fit.
+ * @param[in] decimal Decimal places to keep for each floating-point number, at most 15.
+ * @param[in] separator Character to separate between numbers.
+ * @return Length of the written string, excluding the null terminator.
+ * @throw std::invalid_argument if [decimal] is larger than 15.
+ * @note Real-time (RT).
+ * @note Same output as Vec2Str() with the same [decimal] and [separator], except that character
+ * types such as int8_t are formatted as numbers instead of characters. Floating-point numbers
+ * are rounded from their exact binary value like printf("%.*f"), e.g. 1.2345 with 3 decimal places
+ * gives "1.234", because the nearest double of 1.2345 is slightly smaller than it.
+ */
+template <typename T>
+inline size_t Nums2Buf(const T* nums, size_t num, char* buffer, size_t buffer_size,
+    size_t decimal = 3, char separator = ' ')
+{
+    static_assert(std::is_arithmetic<T>::value, "Nums2Buf: Only numbers can be formatted");
+    if (decimal > 15) {
+        throw std::invalid_argument("Nums2Buf: [decimal] cannot be larger than 15");
+    }
+    if (buffer_size == 0) {
+        return 0;
+    }
+
+    size_t len = 0;
+    const size_t max_len = buffer_size - 1;
+    auto put = [&](const char* str, size_t size) {
+        const size_t n = std::min(size, max_len - len);
+        std::memcpy(buffer + len, str, n);
+        len += n;
+    };
+    // Write the digits of an unsigned integer
+    auto put_uint = [&](unsigned long long value) {
+        char digits[20];
+        size_t n = sizeof(digits);
+        do {
+            digits[--n] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        put(digits + n, sizeof(digits) - n);
+    };
+
+    for (size_t i = 0; i < num && len < max_len; i++) {
+        if (i > 0) {
+            put(&separator, 1);
+        }
+        if constexpr (std::is_integral<T>::value && std::is_unsigned<T>::value) {
+            put_uint(static_cast<unsigned long long>(nums[i]));
+        } else if constexpr (std::is_integral<T>::value) {
+            const auto v = static_cast<long long>(nums[i]);
+            if (v < 0) {
+                put("-", 1);
+            }
+            put_uint(v < 0 ? 0ULL - static_cast<unsigned long long>(v)
+                           : static_cast<unsigned long long>(v));
+        } else {
+            // Large enough for the largest double with 15 decimals, rounded from the exact binary
+            // value like printf("%.*f") and thus Vec2Str()
+            char tmp[336];
+            const double v = static_cast<double>(nums[i]);
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            const auto result = std::to_chars(tmp, tmp + sizeof(tmp), v, std::chars_format::fixed,
+                static_cast<int>(decimal));
+            put(tmp, result.ec == std::errc() ? static_cast<size_t>(result.ptr - tmp) : 0);
+#else
+            const int n = std::snprintf(tmp, sizeof(tmp), "%.*f", static_cast<int>(decimal), v);
+            put(tmp, n > 0 ? std::min(static_cast<size_t>(n), sizeof(tmp) - 1) : 0);
+#endif
+        }
+    }
+    buffer[len] = '\0';
+    return len;
 }
 
 /**
@@ -36,8 +36,9 @@ void StepDynamics(flexiv::rdk::Robot& robot, flexiv::rdk::Model& model, const Gr
     // Mark timer start point
     auto tic = std::chrono::high_resolution_clock::now();
 
-    // Update robot model in dynamics engine
-    model.Update(robot.states().q, robot.states().dtheta);
+    // Update robot model in dynamics engine using one consistent states snapshot
+    const auto states = robot.states();
+    model.Update(states.q, states.dtheta);
 
     // Get J, M, G from dynamic engine
     Eigen::MatrixXd J = model.J("flange");
@@ -8,6 +8,7 @@
 
 #include <flexiv/rdk/robot.hpp>
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/spsc_queue.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -40,9 +41,17 @@ const unsigned int kLogDurationLoopCounts = 10 * 60 * 1000; // = 10 min/file
 /** Data to be logged in low-priority thread */
 struct LogData
 {
+    uint64_t loop_counter;
     std::array<double, flexiv::rdk::kPoseSize> tcp_pose;
     std::array<double, flexiv::rdk::kCartDoF> tcp_force;
-} g_log_data;
+};
+
+/** Lock-free queue passing log data from high-priority task to low-priority thread, can buffer up
+ * to 4 seconds of data */
+flexiv::rdk::SPSCQueue<LogData, 4096> g_log_queue;
+
+/** Number of log data dropped because the queue was full */
+std::atomic<uint64_t> g_num_dropped = {0};
 
 /** Atomic signal to stop the test */
 std::atomic<bool> g_stop = {false};
@@ -66,10 +75,14 @@ void highPriorityTask(
             = init_pose[2] + kSwingAmp * sin(2 * M_PI * kSwingFreq * loop_counter * kLoopPeriod);
         robot.StreamCartesianMotionForce(g_curr_tcp_pose);
 
-        // Save data to global buffer, not using mutex to avoid interruption on RT loop from
-        // potential priority inversion
-        g_log_data.tcp_pose = robot.states().tcp_pose;
-        g_log_data.tcp_force = robot.states().ext_wrench_in_world;
+        // Read robot states only once per cycle
+        const auto states = robot.states();
+
+        // Push data to the lock-free log queue, not using mutex to avoid interruption on RT loop
+        // from potential priority inversion
+        if (!g_log_queue.Push({loop_counter, states.tcp_pose, states.ext_wrench_in_world})) {
+            g_num_dropped++;
+        }
 
         // Stop after test duration has elapsed
         if (++loop_counter > g_test_duration_loop_counts) {
@@ -84,8 +97,8 @@ void highPriorityTask(
 
 void lowPriorityTask()
 {
-    // Low-priority task loop counter
-    uint64_t loop_counter = 0;
+    // Log data popped from the queue
+    LogData log_data;
 
     // Data logging CSV file
     std::ofstream csv_file;
@@ -101,49 +114,55 @@ void lowPriorityTask()
 
     // Use while loop to prevent this thread from return
     while (true) {
-        // Log data at 1kHz
+        // Check for new data at 1kHz
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        loop_counter++;
 
-        // Close existing log file and create a new one periodically
-        if (loop_counter % kLogDurationLoopCounts == 0) {
-            if (csv_file.is_open()) {
-                csv_file.close();
-                spdlog::info("Saved log file: {}", csv_file_name);
+        // Log all data pushed by the high-priority task since the last check
+        while (g_log_queue.Pop(log_data)) {
+            // Close existing log file and create a new one periodically
+            if (log_data.loop_counter % kLogDurationLoopCounts == 0) {
+                if (csv_file.is_open()) {
+                    csv_file.close();
+                    spdlog::info("Saved log file: {}", csv_file_name);
+                }
+
+                // Increment log file counter
+                file_counter++;
+
+                // Create new file name using the updated counter as suffix
+                csv_file_name = "endurance_test_data_" + std::to_string(file_counter) + ".csv";
+
+                // Open new log file
+                csv_file.open(csv_file_name);
+                if (csv_file.is_open()) {
+                    spdlog::info("Created new log file: {}", csv_file_name);
+                } else {
+                    spdlog::error("Failed to create log file: {}", csv_file_name);
+                }
             }
 
-            // Increment log file counter
-            file_counter++;
-
-            // Create new file name using the updated counter as suffix
-            csv_file_name = "endurance_test_data_" + std::to_string(file_counter) + ".csv";
-
-            // Open new log file
-            csv_file.open(csv_file_name);
+            // Log data to file in CSV format
             if (csv_file.is_open()) {
-                spdlog::info("Created new log file: {}", csv_file_name);
-            } else {
-                spdlog::error("Failed to create log file: {}", csv_file_name);
+                // Loop counter x1, TCP pose x7, TCP external force x6
+                csv_file << log_data.loop_counter << ",";
+                for (const auto& i : log_data.tcp_pose) {
+                    csv_file << i << ",";
+                }
+                for (const auto& i : log_data.tcp_force) {
+                    csv_file << i << ",";
+                }
+                // End of line
+                csv_file << '\n';
             }
         }
 
-        // Log data to file in CSV format
-        if (csv_file.is_open()) {
-            // Loop counter x1, TCP pose x7, TCP external force x6
-            csv_file << loop_counter << ",";
-            for (const auto& i : g_log_data.tcp_pose) {
-                csv_file << i << ",";
-            }
-            for (const auto& i : g_log_data.tcp_force) {
-                csv_file << i << ",";
-            }
-            // End of line
-            csv_file << '\n';
-        }
-
         // Check if the test duration has elapsed
         if (g_stop) {
             spdlog::info("Test duration has elapsed, saving any open log file ...");
+            if (g_num_dropped > 0) {
+                spdlog::warn(
+                    "{} log data were dropped due to full log queue", g_num_dropped.load());
+            }
             // Close log file
             if (csv_file.is_open()) {
                 csv_file.close();
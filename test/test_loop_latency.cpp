@@ -9,6 +9,7 @@
 
 #include <flexiv/rdk/robot.hpp>
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/scheduler_config.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -112,6 +113,13 @@ int main(int argc, char* argv[])
     std::string serial_port = argv[2];
 
     try {
+        // Real-time Setup
+        //=============================================================================
+        // Lock memory and prefault the stack before any RDK thread is created, so that the
+        // measured latency is not polluted by page faults
+        auto rt_report = flexiv::rdk::ApplySchedulerConfig(flexiv::rdk::SchedulerConfig());
+        spdlog::info("Real-time setup applied: {}", rt_report.str());
+
         // RDK Initialization
         //=============================================================================
         // Instantiate robot interface
@@ -6,6 +6,7 @@
  */
 
 #include <flexiv/rdk/scheduler.hpp>
+#include <flexiv/rdk/task_monitor.hpp>
 #include <flexiv/rdk/utility.hpp>
 #include <spdlog/spdlog.h>
 
@@ -27,6 +28,9 @@ std::mutex g_mutex;
 
 /** Atomic signal to stop scheduler tasks */
 std::atomic<bool> g_stop_sched = {false};
+
+/** Timing statistics of the scheduler tasks */
+flexiv::rdk::TaskMonitor g_task_monitor;
 }
 
 /** User-defined high-priority periodic task @ 1kHz */
@@ -88,6 +92,15 @@ void lowPriorityTask()
     // print time interval of high-priority periodic task
     spdlog::info(
         "High-priority task interval (curr | avg) = {} | {} us", measured_interval, avg_interval);
+
+    // Print timing statistics of high-priority periodic task
+    auto stats = g_task_monitor.stats("HP periodic");
+    spdlog::info("High-priority task jitter (p50 | p99 | p99.9 | max) = {} | {} | {} | {} us",
+        stats.jitter.p50, stats.jitter.p99, stats.jitter.p999, stats.jitter.max);
+    spdlog::info("High-priority task execution time (p50 | p99 | max) = {} | {} | {} us, {} "
+                 "overruns in {} executions",
+        stats.exec_time.p50, stats.exec_time.p99, stats.exec_time.max, stats.overruns,
+        stats.count);
 }
 
 void PrintHelp()
@@ -113,7 +126,8 @@ int main(int argc, char* argv[])
         //==========================================================================================
         flexiv::rdk::Scheduler scheduler;
         // Add periodic task with 1ms interval and highest applicable priority
-        scheduler.AddTask(std::bind(highPriorityTask), "HP periodic", 1, scheduler.max_priority());
+        scheduler.AddTask(g_task_monitor.Wrap(std::bind(highPriorityTask), "HP periodic", 1),
+            "HP periodic", 1, scheduler.max_priority());
         // Add periodic task with 1s interval and lowest applicable priority
         scheduler.AddTask(std::bind(lowPriorityTask), "LP periodic", 1000, 0);
         // Start all added tasks
@@ -0,0 +1,137 @@
+/**
+ * @test test_utility.cpp
+ * A test to check the allocation-free formatting and conversion helpers in utility.hpp against
+ * their string-based counterparts. No robot is needed.
+ * @copyright Copyright (C) 2016-2025 Flexiv Ltd. All Rights Reserved.
+ * @author Flexiv
+ */
+
+#include <flexiv/rdk/utility.hpp>
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+/** Number of failed checks */
+size_t g_num_failures = 0;
+
+/** @brief Check that Nums2Buf() gives the same output as Vec2Str() */
+template <typename T>
+void CheckSameAsVec2Str(const std::vector<T>& nums, size_t decimal)
+{
+    char buffer[1024];
+    flexiv::rdk::utility::Nums2Buf(nums.data(), nums.size(), buffer, sizeof(buffer), decimal);
+    const auto expected = flexiv::rdk::utility::Vec2Str(nums, decimal);
+    if (expected != buffer) {
+        spdlog::error("Nums2Buf: expected [{}], got [{}]", expected, buffer);
+        g_num_failures++;
+    }
+}
+
+/** @brief Check that Nums2Buf() gives the expected output */
+template <typename T>
+void CheckEqual(const std::vector<T>& nums, size_t decimal, const std::string& expected)
+{
+    char buffer[1024];
+    flexiv::rdk::utility::Nums2Buf(nums.data(), nums.size(), buffer, sizeof(buffer), decimal);
+    if (expected != buffer) {
+        spdlog::error("Nums2Buf: expected [{}], got [{}]", expected, buffer);
+        g_num_failures++;
+    }
+}
+
+void PrintHelp()
+{
+    // clang-format off
+    std::cout << "Required arguments: None" << std::endl;
+    std::cout << "Optional arguments: None" << std::endl;
+    std::cout << std::endl;
+    // clang-format on
+}
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse Parameters
+    //==============================================================================================
+    if (flexiv::rdk::utility::ProgramArgsExistAny(argc, argv, {"-h", "--help"})) {
+        PrintHelp();
+        return 1;
+    }
+
+    try {
+        // Nums2Buf
+        //==========================================================================================
+        // Rounding from the exact binary value, same as Vec2Str()
+        CheckEqual(std::vector<double> {1.2345, 0.125, 2.5}, 3, "1.234 0.125 2.500");
+        CheckEqual(std::vector<double> {0.125, 2.5, -0.0004}, 2, "0.12 2.50 -0.00");
+        CheckSameAsVec2Str(std::vector<double> {1.2345, -1.2345, 0.0005, -0.0005}, 3);
+
+        // Large, negative and non-finite values
+        CheckSameAsVec2Str(std::vector<double> {1e20, -1e20, 1.5e300, -123456789.987654321}, 3);
+        CheckSameAsVec2Str(std::vector<double> {std::numeric_limits<double>::max()}, 15);
+        CheckEqual(std::vector<double> {std::numeric_limits<double>::infinity(), std::nan("")}, 3,
+            "inf nan");
+
+        // Integral types over their full range
+        CheckSameAsVec2Str(std::vector<int> {0, -1, std::numeric_limits<int>::min(),
+                               std::numeric_limits<int>::max()},
+            3);
+        CheckSameAsVec2Str(std::vector<int64_t> {std::numeric_limits<int64_t>::min()}, 3);
+        CheckSameAsVec2Str(std::vector<uint64_t> {~0ULL, 0, 1ULL << 63}, 3);
+        CheckEqual(std::vector<uint64_t> {~0ULL}, 3, "18446744073709551615");
+
+        // Random values at various decimal places
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        for (size_t i = 0; i < 10000; i++) {
+            CheckSameAsVec2Str(std::vector<double> {dist(gen), dist(gen) * 1e-4}, i % 16);
+        }
+
+        // Truncation keeps the output null-terminated
+        char small[6];
+        const std::vector<double> nums = {123.456, 7.0};
+        const size_t len = flexiv::rdk::utility::Nums2Buf(nums.data(), nums.size(), small, 6);
+        if (len != 5 || std::string(small) != "123.4") {
+            spdlog::error("Nums2Buf: truncated output is [{}]", small);
+            g_num_failures++;
+        }
+
+        // Quat2EulerZYX
+        //==========================================================================================
+        // Same result as Eigen's eulerAngles(2, 1, 0), including its angle ranges
+        std::normal_distribution<double> normal;
+        for (size_t i = 0; i < 10000; i++) {
+            Eigen::Quaterniond q(normal(gen), normal(gen), normal(gen), normal(gen));
+            q.normalize();
+            const auto euler
+                = flexiv::rdk::utility::Quat2EulerZYX({q.w(), q.x(), q.y(), q.z()});
+            const Eigen::Vector3d expected = q.toRotationMatrix().eulerAngles(2, 1, 0);
+            if (std::abs(euler[0] - expected[2]) > 1e-9 || std::abs(euler[1] - expected[1]) > 1e-9
+                || std::abs(euler[2] - expected[0]) > 1e-9) {
+                spdlog::error("Quat2EulerZYX: expected [{}], got [{}]",
+                    flexiv::rdk::utility::Vec2Str(
+                        std::vector<double> {expected[2], expected[1], expected[0]}),
+                    flexiv::rdk::utility::Arr2Str(euler));
+                g_num_failures++;
+            }
+        }
+
+    } catch (const std::exception& e) {
+        spdlog::error(e.what());
+        return 1;
+    }
+
+    if (g_num_failures > 0) {
+        spdlog::error("{} checks failed", g_num_failures);
+        return 1;
+    }
+    spdlog::info("All checks passed");
+    return 0;
+}